@@ -355,6 +355,7 @@ ifeq ($(strip $(LED_MATRIX_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/process_keycode/process_backlight.c
     SRC += $(QUANTUM_DIR)/led_matrix/led_matrix.c
     SRC += $(QUANTUM_DIR)/led_matrix/led_matrix_drivers.c
+    SRC += $(QUANTUM_DIR)/effect_scheduler.c
     LIB8TION_ENABLE := yes
     CIE1931_CURVE := yes
 
@@ -455,6 +456,8 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/color.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_drivers.c
+    SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_compositor.c
+    SRC += $(QUANTUM_DIR)/effect_scheduler.c
     LIB8TION_ENABLE := yes
     CIE1931_CURVE := yes
     RGB_KEYCODES_ENABLE := yes
@@ -645,6 +648,16 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
+
+        VALID_MATRIX_SCAN_MODE_TYPES := polling interrupt
+        MATRIX_SCAN_MODE ?= polling
+        ifeq ($(filter $(MATRIX_SCAN_MODE),$(VALID_MATRIX_SCAN_MODE_TYPES)),)
+            $(call CATASTROPHIC_ERROR,Invalid MATRIX_SCAN_MODE,MATRIX_SCAN_MODE="$(MATRIX_SCAN_MODE)" is not a valid matrix scan mode)
+        endif
+        ifeq ($(strip $(MATRIX_SCAN_MODE)), interrupt)
+            OPT_DEFS += -DMATRIX_SCAN_MODE_INTERRUPT
+            QUANTUM_SRC += $(QUANTUM_DIR)/matrix_interrupt.c
+        endif
     endif
 endif
 
@@ -20,3 +20,7 @@
 
 void eeprom_driver_init(void);
 void eeprom_driver_erase(void);
+/* for drivers that defer writes: eeprom_driver_task() makes progress in the background,
+ * eeprom_driver_flush() blocks until everything has been written */
+void eeprom_driver_task(void);
+void eeprom_driver_flush(void);
@@ -15,6 +15,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #if defined(EXTERNAL_EEPROM_WP_PIN)
 #    include "gpio.h"
@@ -45,6 +46,30 @@
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+#if defined(EXTERNAL_EEPROM_WRITE_QUEUE)
+#    include "timer.h"
+#    include "eeprom_driver.h"
+
+/*
+    With EXTERNAL_EEPROM_WRITE_QUEUE, writes are collected per page in RAM and
+    written out by eeprom_driver_task(), one page per call. Instead of waiting
+    a fixed EXTERNAL_EEPROM_WRITE_TIME after each page, the device is polled for
+    an ACK, which it only gives once the write cycle has completed.
+*/
+typedef struct {
+    uintptr_t page;
+    uint8_t   dirty[(EXTERNAL_EEPROM_PAGE_SIZE + 7) / 8];
+    uint8_t   data[EXTERNAL_EEPROM_PAGE_SIZE];
+} eeprom_queue_page_t;
+
+static eeprom_queue_page_t eeprom_queue[EXTERNAL_EEPROM_WRITE_QUEUE_PAGES];
+static uint8_t             eeprom_queue_head   = 0;
+static uint8_t             eeprom_queue_count  = 0;
+static bool                eeprom_busy         = false;
+static uintptr_t           eeprom_busy_address = 0;
+static uint32_t            eeprom_busy_since   = 0;
+#endif // EXTERNAL_EEPROM_WRITE_QUEUE
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -53,19 +78,136 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
-void eeprom_driver_init(void) {
-    i2c_init();
 #if defined(EXTERNAL_EEPROM_WP_PIN)
-    /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
-    writePin(EXTERNAL_EEPROM_WP_PIN, 1);
-    setPinInputHigh(EXTERNAL_EEPROM_WP_PIN);
+static inline void eeprom_write_protect(bool protect) {
+    if (protect) {
+        /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
+        writePin(EXTERNAL_EEPROM_WP_PIN, 1);
+        setPinInputHigh(EXTERNAL_EEPROM_WP_PIN);
+    } else {
+        setPinOutput(EXTERNAL_EEPROM_WP_PIN);
+        writePin(EXTERNAL_EEPROM_WP_PIN, 0);
+    }
+}
+#else
+#    define eeprom_write_protect(protect)
 #endif
+
+void eeprom_driver_init(void) {
+    i2c_init();
+    eeprom_write_protect(true);
+}
+
+#if defined(EXTERNAL_EEPROM_WRITE_QUEUE)
+/* Returns whether the device has finished its last write cycle, polling it if required */
+static bool eeprom_ready(void) {
+    if (eeprom_busy) {
+        uint8_t address[EXTERNAL_EEPROM_ADDRESS_SIZE];
+        fill_target_address(address, (const void *)eeprom_busy_address);
+        // The device does not acknowledge its address until the write cycle is complete. Give up
+        // polling after twice the specified write time, in case the device never responds.
+        if (i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(eeprom_busy_address), address, EXTERNAL_EEPROM_ADDRESS_SIZE, 10) == I2C_STATUS_SUCCESS || timer_elapsed32(eeprom_busy_since) > EXTERNAL_EEPROM_WRITE_TIME * 2) {
+            eeprom_busy = false;
+            eeprom_write_protect(true);
+        }
+    }
+    return !eeprom_busy;
+}
+
+static void eeprom_wait_ready(void) {
+    while (!eeprom_ready()) {
+        wait_ms(1);
+    }
+}
+
+static inline bool eeprom_queue_is_dirty(const eeprom_queue_page_t *entry, uint16_t offset) {
+    return entry->dirty[offset / 8] & (1 << (offset % 8));
+}
+
+static eeprom_queue_page_t *eeprom_queue_find(uintptr_t page) {
+    for (uint8_t i = 0; i < eeprom_queue_count; i++) {
+        eeprom_queue_page_t *entry = &eeprom_queue[(eeprom_queue_head + i) % EXTERNAL_EEPROM_WRITE_QUEUE_PAGES];
+        if (entry->page == page) {
+            return entry;
+        }
+    }
+    return NULL;
 }
 
+static void eeprom_queue_fill_gaps(eeprom_queue_page_t *entry, uint16_t first, uint16_t last) {
+    uint8_t complete_data[EXTERNAL_EEPROM_PAGE_SIZE];
+    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
+    fill_target_address(complete_packet, (const void *)entry->page);
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(entry->page), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
+    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS(entry->page), complete_data, EXTERNAL_EEPROM_PAGE_SIZE, 100);
+    for (uint16_t i = first; i <= last; i++) {
+        if (!eeprom_queue_is_dirty(entry, i)) {
+            entry->data[i] = complete_data[i];
+        }
+    }
+}
+
+/* Writes out the oldest queued page, the device must be ready */
+static void eeprom_queue_write_head(void) {
+    eeprom_queue_page_t *entry = &eeprom_queue[eeprom_queue_head];
+    uint16_t             first = 0;
+    uint16_t             last  = EXTERNAL_EEPROM_PAGE_SIZE - 1;
+    while (!eeprom_queue_is_dirty(entry, first)) {
+        first++;
+    }
+    while (!eeprom_queue_is_dirty(entry, last)) {
+        last--;
+    }
+
+    // A page write has to be contiguous, so fill any gaps with what is already stored
+    for (uint16_t i = first; i <= last; i++) {
+        if (!eeprom_queue_is_dirty(entry, i)) {
+            eeprom_queue_fill_gaps(entry, first, last);
+            break;
+        }
+    }
+
+    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
+    fill_target_address(complete_packet, (const void *)(entry->page + first));
+    memcpy(&complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE], &entry->data[first], last - first + 1);
+
+    eeprom_write_protect(false);
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(entry->page), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + last - first + 1, 100);
+    if (EXTERNAL_EEPROM_WRITE_TIME > 0) {
+        eeprom_busy         = true;
+        eeprom_busy_address = entry->page;
+        eeprom_busy_since   = timer_read32();
+    } else {
+        eeprom_write_protect(true);
+    }
+
+    eeprom_queue_head = (eeprom_queue_head + 1) % EXTERNAL_EEPROM_WRITE_QUEUE_PAGES;
+    eeprom_queue_count--;
+}
+
+void eeprom_driver_task(void) {
+    if (eeprom_queue_count > 0 && eeprom_ready()) {
+        eeprom_queue_write_head();
+    }
+}
+
+void eeprom_driver_flush(void) {
+    while (eeprom_queue_count > 0) {
+        eeprom_wait_ready();
+        eeprom_queue_write_head();
+    }
+    eeprom_wait_ready();
+}
+#endif // EXTERNAL_EEPROM_WRITE_QUEUE
+
 void eeprom_driver_erase(void) {
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     uint32_t start = timer_read32();
 #endif
+#if defined(EXTERNAL_EEPROM_WRITE_QUEUE)
+    // Anything still queued would be erased anyway
+    eeprom_queue_count = 0;
+#endif
 
     uint8_t buf[EXTERNAL_EEPROM_PAGE_SIZE];
     memset(buf, 0x00, EXTERNAL_EEPROM_PAGE_SIZE);
@@ -82,8 +224,28 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
     fill_target_address(complete_packet, addr);
 
+#if defined(EXTERNAL_EEPROM_WRITE_QUEUE)
+    // Reads entirely covered by queued writes do not need to touch the device
+    bool covered = true;
+    for (uintptr_t p = (uintptr_t)addr; covered && p < (uintptr_t)addr + len; p++) {
+        eeprom_queue_page_t *entry = eeprom_queue_find(p - p % EXTERNAL_EEPROM_PAGE_SIZE);
+        covered                    = entry && eeprom_queue_is_dirty(entry, p % EXTERNAL_EEPROM_PAGE_SIZE);
+    }
+    if (!covered) {
+        eeprom_wait_ready();
+        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
+        i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
+    }
+    for (uintptr_t p = (uintptr_t)addr; p < (uintptr_t)addr + len; p++) {
+        eeprom_queue_page_t *entry = eeprom_queue_find(p - p % EXTERNAL_EEPROM_PAGE_SIZE);
+        if (entry && eeprom_queue_is_dirty(entry, p % EXTERNAL_EEPROM_PAGE_SIZE)) {
+            ((uint8_t *)buf)[p - (uintptr_t)addr] = entry->data[p % EXTERNAL_EEPROM_PAGE_SIZE];
+        }
+    }
+#else
     i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
     i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
+#endif
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
@@ -94,15 +256,49 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 #endif // DEBUG_EEPROM_OUTPUT
 }
 
+#if defined(EXTERNAL_EEPROM_WRITE_QUEUE)
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *read_buf    = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
+
+    while (len > 0) {
+        uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
+        uintptr_t page         = target_addr - page_offset;
+        size_t    write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
+        if (write_length > len) {
+            write_length = len;
+        }
+
+        eeprom_queue_page_t *entry = eeprom_queue_find(page);
+        if (!entry) {
+            if (eeprom_queue_count == EXTERNAL_EEPROM_WRITE_QUEUE_PAGES) {
+                // Queue is full, so make room by writing out the oldest page now
+                eeprom_wait_ready();
+                eeprom_queue_write_head();
+            }
+            entry       = &eeprom_queue[(eeprom_queue_head + eeprom_queue_count) % EXTERNAL_EEPROM_WRITE_QUEUE_PAGES];
+            entry->page = page;
+            memset(entry->dirty, 0, sizeof(entry->dirty));
+            eeprom_queue_count++;
+        }
+
+        for (uint16_t i = 0; i < write_length; i++) {
+            entry->data[page_offset + i] = read_buf[i];
+            entry->dirty[(page_offset + i) / 8] |= 1 << ((page_offset + i) % 8);
+        }
+
+        read_buf += write_length;
+        target_addr += write_length;
+        len -= write_length;
+    }
+}
+#else
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     uint8_t   complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
     uint8_t * read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
 
-#if defined(EXTERNAL_EEPROM_WP_PIN)
-    setPinOutput(EXTERNAL_EEPROM_WP_PIN);
-    writePin(EXTERNAL_EEPROM_WP_PIN, 0);
-#endif
+    eeprom_write_protect(false);
 
     while (len > 0) {
         uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
@@ -132,9 +328,6 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         len -= write_length;
     }
 
-#if defined(EXTERNAL_EEPROM_WP_PIN)
-    /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
-    writePin(EXTERNAL_EEPROM_WP_PIN, 1);
-    setPinInputHigh(EXTERNAL_EEPROM_WP_PIN);
-#endif
+    eeprom_write_protect(true);
 }
+#endif // EXTERNAL_EEPROM_WRITE_QUEUE
@@ -123,3 +123,11 @@
 #ifndef EXTERNAL_EEPROM_WRITE_TIME
 #    define EXTERNAL_EEPROM_WRITE_TIME 5
 #endif
+
+/*
+    The number of pages held in RAM when EXTERNAL_EEPROM_WRITE_QUEUE is enabled.
+    Writes to a page that is already queued are merged into a single page write.
+*/
+#ifndef EXTERNAL_EEPROM_WRITE_QUEUE_PAGES
+#    define EXTERNAL_EEPROM_WRITE_QUEUE_PAGES 4
+#endif
@@ -159,3 +159,26 @@ void aw20216s_flush(void) {
     aw20216s_update_pwm_buffers(AW20216S_CS_PIN_2, 1);
 #endif
 }
+
+void aw20216s_sw_return_normal(pin_t cs_pin) {
+    aw20216s_soft_enable(cs_pin);
+}
+
+void aw20216s_sw_shutdown(pin_t cs_pin) {
+    // Clearing CHIPEN stops the outputs, the scaling and PWM registers are kept
+    aw20216s_write_register(cs_pin, AW20216S_PAGE_FUNCTION, AW20216S_FUNCTION_REG_CONFIGURATION, AW20216S_CONFIGURATION & ~AW20216S_CONFIGURATION_CHIPEN);
+}
+
+void aw20216s_sw_return_normal_drivers(void) {
+    aw20216s_sw_return_normal(AW20216S_CS_PIN_1);
+#if defined(AW20216S_CS_PIN_2)
+    aw20216s_sw_return_normal(AW20216S_CS_PIN_2);
+#endif
+}
+
+void aw20216s_sw_shutdown_drivers(void) {
+    aw20216s_sw_shutdown(AW20216S_CS_PIN_1);
+#if defined(AW20216S_CS_PIN_2)
+    aw20216s_sw_shutdown(AW20216S_CS_PIN_2);
+#endif
+}
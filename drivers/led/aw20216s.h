@@ -101,6 +101,11 @@ void aw20216s_update_pwm_buffers(pin_t cs_pin, uint8_t index);
 
 void aw20216s_flush(void);
 
+void aw20216s_sw_return_normal(pin_t cs_pin);
+void aw20216s_sw_shutdown(pin_t cs_pin);
+void aw20216s_sw_return_normal_drivers(void);
+void aw20216s_sw_shutdown_drivers(void);
+
 #define CS1_SW1 0x00
 #define CS2_SW1 0x01
 #define CS3_SW1 0x02
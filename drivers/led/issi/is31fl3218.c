@@ -161,3 +161,13 @@ void is31fl3218_update_led_control_registers(void) {
         g_led_control_registers_update_required = false;
     }
 }
+
+void is31fl3218_sw_return_normal(void) {
+    // Turn off software shutdown
+    is31fl3218_write_register(IS31FL3218_REG_SHUTDOWN, 0x01);
+}
+
+void is31fl3218_sw_shutdown(void) {
+    // Turn on software shutdown, the PWM and LED control registers are kept
+    is31fl3218_write_register(IS31FL3218_REG_SHUTDOWN, 0x00);
+}
@@ -41,8 +41,8 @@ uint8_t g_twi_transfer_buffer[20];
 // We could optimize this and take out the unused registers from these
 // buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
-uint8_t g_pwm_buffer[IS31FL3731_DRIVER_COUNT][IS31FL3731_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[IS31FL3731_DRIVER_COUNT] = {false};
+uint8_t  g_pwm_buffer[IS31FL3731_DRIVER_COUNT][IS31FL3731_PWM_REGISTER_COUNT];
+uint16_t g_pwm_buffer_dirty_chunks[IS31FL3731_DRIVER_COUNT] = {0};
 
 uint8_t g_led_control_registers[IS31FL3731_DRIVER_COUNT][IS31FL3731_LED_CONTROL_REGISTER_COUNT] = {0};
 bool    g_led_control_registers_update_required[IS31FL3731_DRIVER_COUNT]                        = {false};
@@ -62,7 +62,8 @@ void is31fl3731_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+// Sends the 16 byte chunks of the PWM buffer flagged in dirty_chunks
+static void is31fl3731_write_pwm_chunks(uint8_t addr, uint8_t *pwm_buffer, uint16_t dirty_chunks) {
     // assumes bank is already selected
 
     // transmit PWM registers in 9 transfers of 16 bytes
@@ -70,6 +71,9 @@ void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
 
     // iterate over the pwm_buffer contents at 16 byte intervals
     for (int i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
+        if (!(dirty_chunks & (1 << (i / 16)))) {
+            continue;
+        }
         // set the first register, e.g. 0x24, 0x34, 0x44, etc.
         g_twi_transfer_buffer[0] = 0x24 + i;
         // copy the data from i to i+15
@@ -87,6 +91,10 @@ void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     }
 }
 
+void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    is31fl3731_write_pwm_chunks(addr, pwm_buffer, UINT16_MAX);
+}
+
 void is31fl3731_init_drivers(void) {
     i2c_init();
 
@@ -182,8 +190,9 @@ void is31fl3731_set_value(int index, uint8_t value) {
         if (g_pwm_buffer[led.driver][led.v - 0x24] == value) {
             return;
         }
-        g_pwm_buffer[led.driver][led.v - 0x24]   = value;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led.driver][led.v - 0x24] = value;
+
+        g_pwm_buffer_dirty_chunks[led.driver] |= (1 << ((led.v - 0x24) / 16));
     }
 }
 
@@ -210,9 +219,9 @@ void is31fl3731_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3731_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
-        is31fl3731_write_pwm_buffer(addr, g_pwm_buffer[index]);
-        g_pwm_buffer_update_required[index] = false;
+    if (g_pwm_buffer_dirty_chunks[index]) {
+        is31fl3731_write_pwm_chunks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_chunks[index]);
+        g_pwm_buffer_dirty_chunks[index] = 0;
     }
 }
 
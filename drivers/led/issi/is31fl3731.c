@@ -40,8 +40,8 @@ uint8_t g_twi_transfer_buffer[20];
 // We could optimize this and take out the unused registers from these
 // buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
-uint8_t g_pwm_buffer[IS31FL3731_DRIVER_COUNT][IS31FL3731_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[IS31FL3731_DRIVER_COUNT] = {false};
+uint8_t  g_pwm_buffer[IS31FL3731_DRIVER_COUNT][IS31FL3731_PWM_REGISTER_COUNT];
+uint16_t g_pwm_buffer_dirty_chunks[IS31FL3731_DRIVER_COUNT] = {0};
 
 uint8_t g_led_control_registers[IS31FL3731_DRIVER_COUNT][IS31FL3731_LED_CONTROL_REGISTER_COUNT] = {0};
 bool    g_led_control_registers_update_required[IS31FL3731_DRIVER_COUNT]                        = {false};
@@ -59,7 +59,8 @@ void is31fl3731_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+// Sends the 16 byte chunks of the PWM buffer flagged in dirty_chunks
+static void is31fl3731_write_pwm_chunks(uint8_t addr, uint8_t *pwm_buffer, uint16_t dirty_chunks) {
     // assumes bank is already selected
 
     // transmit PWM registers in 9 transfers of 16 bytes
@@ -67,6 +68,9 @@ void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
 
     // iterate over the pwm_buffer contents at 16 byte intervals
     for (int i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
+        if (!(dirty_chunks & (1 << (i / 16)))) {
+            continue;
+        }
         // set the first register, e.g. 0x24, 0x34, 0x44, etc.
         g_twi_transfer_buffer[0] = 0x24 + i;
         // copy the data from i to i+15
@@ -84,6 +88,10 @@ void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     }
 }
 
+void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    is31fl3731_write_pwm_chunks(addr, pwm_buffer, UINT16_MAX);
+}
+
 void is31fl3731_init_drivers(void) {
     i2c_init();
 
@@ -178,10 +186,11 @@ void is31fl3731_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         if (g_pwm_buffer[led.driver][led.r - 0x24] == red && g_pwm_buffer[led.driver][led.g - 0x24] == green && g_pwm_buffer[led.driver][led.b - 0x24] == blue) {
             return;
         }
-        g_pwm_buffer[led.driver][led.r - 0x24]   = red;
-        g_pwm_buffer[led.driver][led.g - 0x24]   = green;
-        g_pwm_buffer[led.driver][led.b - 0x24]   = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led.driver][led.r - 0x24] = red;
+        g_pwm_buffer[led.driver][led.g - 0x24] = green;
+        g_pwm_buffer[led.driver][led.b - 0x24] = blue;
+
+        g_pwm_buffer_dirty_chunks[led.driver] |= (1 << ((led.r - 0x24) / 16)) | (1 << ((led.g - 0x24) / 16)) | (1 << ((led.b - 0x24) / 16));
     }
 }
 
@@ -222,10 +231,10 @@ void is31fl3731_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3731_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
-        is31fl3731_write_pwm_buffer(addr, g_pwm_buffer[index]);
+    if (g_pwm_buffer_dirty_chunks[index]) {
+        is31fl3731_write_pwm_chunks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_chunks[index]);
     }
-    g_pwm_buffer_update_required[index] = false;
+    g_pwm_buffer_dirty_chunks[index] = 0;
 }
 
 void is31fl3731_update_led_control_registers(uint8_t addr, uint8_t index) {
@@ -249,3 +258,47 @@ void is31fl3731_flush(void) {
 #    endif
 #endif
 }
+
+void is31fl3731_sw_return_normal(uint8_t addr) {
+    // select "function register" bank
+    is31fl3731_write_register(addr, IS31FL3731_REG_COMMAND, IS31FL3731_COMMAND_FUNCTION);
+    // disable software shutdown
+    is31fl3731_write_register(addr, IS31FL3731_FUNCTION_REG_SHUTDOWN, 0x01);
+    // select bank 0 again, the PWM buffer updates expect it
+    is31fl3731_write_register(addr, IS31FL3731_REG_COMMAND, IS31FL3731_COMMAND_FRAME_1);
+}
+
+void is31fl3731_sw_shutdown(uint8_t addr) {
+    // select "function register" bank
+    is31fl3731_write_register(addr, IS31FL3731_REG_COMMAND, IS31FL3731_COMMAND_FUNCTION);
+    // enable software shutdown, the frame registers are kept
+    is31fl3731_write_register(addr, IS31FL3731_FUNCTION_REG_SHUTDOWN, 0x00);
+    // select bank 0 again, the PWM buffer updates expect it
+    is31fl3731_write_register(addr, IS31FL3731_REG_COMMAND, IS31FL3731_COMMAND_FRAME_1);
+}
+
+void is31fl3731_sw_return_normal_drivers(void) {
+    is31fl3731_sw_return_normal(IS31FL3731_I2C_ADDRESS_1);
+#if defined(IS31FL3731_I2C_ADDRESS_2)
+    is31fl3731_sw_return_normal(IS31FL3731_I2C_ADDRESS_2);
+#    if defined(IS31FL3731_I2C_ADDRESS_3)
+    is31fl3731_sw_return_normal(IS31FL3731_I2C_ADDRESS_3);
+#        if defined(IS31FL3731_I2C_ADDRESS_4)
+    is31fl3731_sw_return_normal(IS31FL3731_I2C_ADDRESS_4);
+#        endif
+#    endif
+#endif
+}
+
+void is31fl3731_sw_shutdown_drivers(void) {
+    is31fl3731_sw_shutdown(IS31FL3731_I2C_ADDRESS_1);
+#if defined(IS31FL3731_I2C_ADDRESS_2)
+    is31fl3731_sw_shutdown(IS31FL3731_I2C_ADDRESS_2);
+#    if defined(IS31FL3731_I2C_ADDRESS_3)
+    is31fl3731_sw_shutdown(IS31FL3731_I2C_ADDRESS_3);
+#        if defined(IS31FL3731_I2C_ADDRESS_4)
+    is31fl3731_sw_shutdown(IS31FL3731_I2C_ADDRESS_4);
+#        endif
+#    endif
+#endif
+}
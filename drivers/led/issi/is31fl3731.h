@@ -120,6 +120,11 @@ void is31fl3731_update_led_control_registers(uint8_t addr, uint8_t index);
 
 void is31fl3731_flush(void);
 
+void is31fl3731_sw_return_normal(uint8_t addr);
+void is31fl3731_sw_shutdown(uint8_t addr);
+void is31fl3731_sw_return_normal_drivers(void);
+void is31fl3731_sw_shutdown_drivers(void);
+
 #define C1_1 0x24
 #define C1_2 0x25
 #define C1_3 0x26
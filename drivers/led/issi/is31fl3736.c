@@ -56,8 +56,8 @@ uint8_t g_twi_transfer_buffer[20];
 // We could optimize this and take out the unused registers from these
 // buffers and the transfers in is31fl3736_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
-uint8_t g_pwm_buffer[IS31FL3736_DRIVER_COUNT][IS31FL3736_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[IS31FL3736_DRIVER_COUNT] = {false};
+uint8_t  g_pwm_buffer[IS31FL3736_DRIVER_COUNT][IS31FL3736_PWM_REGISTER_COUNT];
+uint16_t g_pwm_buffer_dirty_chunks[IS31FL3736_DRIVER_COUNT] = {0};
 
 uint8_t g_led_control_registers[IS31FL3736_DRIVER_COUNT][IS31FL3736_LED_CONTROL_REGISTER_COUNT] = {0};
 bool    g_led_control_registers_update_required[IS31FL3736_DRIVER_COUNT]                        = {false};
@@ -75,7 +75,8 @@ void is31fl3736_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3736_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+// Sends the 16 byte chunks of the PWM buffer flagged in dirty_chunks
+static void is31fl3736_write_pwm_chunks(uint8_t addr, uint8_t *pwm_buffer, uint16_t dirty_chunks) {
     // assumes PG1 is already selected
 
     // transmit PWM registers in 12 transfers of 16 bytes
@@ -83,6 +84,9 @@ void is31fl3736_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
 
     // iterate over the pwm_buffer contents at 16 byte intervals
     for (int i = 0; i < IS31FL3736_PWM_REGISTER_COUNT; i += 16) {
+        if (!(dirty_chunks & (1 << (i / 16)))) {
+            continue;
+        }
         g_twi_transfer_buffer[0] = i;
         // copy the data from i to i+15
         // device will auto-increment register for data after the first byte
@@ -99,6 +103,10 @@ void is31fl3736_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     }
 }
 
+void is31fl3736_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    is31fl3736_write_pwm_chunks(addr, pwm_buffer, UINT16_MAX);
+}
+
 void is31fl3736_init_drivers(void) {
     i2c_init();
 
@@ -182,10 +190,11 @@ void is31fl3736_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
             return;
         }
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+
+        g_pwm_buffer_dirty_chunks[led.driver] |= (1 << (led.r / 16)) | (1 << (led.g / 16)) | (1 << (led.b / 16));
     }
 }
 
@@ -233,13 +242,13 @@ void is31fl3736_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3736_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+    if (g_pwm_buffer_dirty_chunks[index]) {
         // Firstly we need to unlock the command register and select PG1
         is31fl3736_write_register(addr, IS31FL3736_REG_COMMAND_WRITE_LOCK, IS31FL3736_COMMAND_WRITE_LOCK_MAGIC);
         is31fl3736_write_register(addr, IS31FL3736_REG_COMMAND, IS31FL3736_COMMAND_PWM);
 
-        is31fl3736_write_pwm_buffer(addr, g_pwm_buffer[index]);
-        g_pwm_buffer_update_required[index] = false;
+        is31fl3736_write_pwm_chunks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_chunks[index]);
+        g_pwm_buffer_dirty_chunks[index] = 0;
     }
 }
 
@@ -267,3 +276,49 @@ void is31fl3736_flush(void) {
 #    endif
 #endif
 }
+
+void is31fl3736_sw_return_normal(uint8_t addr) {
+    // Unlock the command register.
+    is31fl3736_write_register(addr, IS31FL3736_REG_COMMAND_WRITE_LOCK, IS31FL3736_COMMAND_WRITE_LOCK_MAGIC);
+
+    // Select PG3
+    is31fl3736_write_register(addr, IS31FL3736_REG_COMMAND, IS31FL3736_COMMAND_FUNCTION);
+    // Disable software shutdown.
+    is31fl3736_write_register(addr, IS31FL3736_FUNCTION_REG_CONFIGURATION, ((IS31FL3736_PWM_FREQUENCY & 0b111) << 3) | 0x01);
+}
+
+void is31fl3736_sw_shutdown(uint8_t addr) {
+    // Unlock the command register.
+    is31fl3736_write_register(addr, IS31FL3736_REG_COMMAND_WRITE_LOCK, IS31FL3736_COMMAND_WRITE_LOCK_MAGIC);
+
+    // Select PG3
+    is31fl3736_write_register(addr, IS31FL3736_REG_COMMAND, IS31FL3736_COMMAND_FUNCTION);
+    // Enable software shutdown, the LED control and PWM registers are kept.
+    is31fl3736_write_register(addr, IS31FL3736_FUNCTION_REG_CONFIGURATION, ((IS31FL3736_PWM_FREQUENCY & 0b111) << 3));
+}
+
+void is31fl3736_sw_return_normal_drivers(void) {
+    is31fl3736_sw_return_normal(IS31FL3736_I2C_ADDRESS_1);
+#if defined(IS31FL3736_I2C_ADDRESS_2)
+    is31fl3736_sw_return_normal(IS31FL3736_I2C_ADDRESS_2);
+#    if defined(IS31FL3736_I2C_ADDRESS_3)
+    is31fl3736_sw_return_normal(IS31FL3736_I2C_ADDRESS_3);
+#        if defined(IS31FL3736_I2C_ADDRESS_4)
+    is31fl3736_sw_return_normal(IS31FL3736_I2C_ADDRESS_4);
+#        endif
+#    endif
+#endif
+}
+
+void is31fl3736_sw_shutdown_drivers(void) {
+    is31fl3736_sw_shutdown(IS31FL3736_I2C_ADDRESS_1);
+#if defined(IS31FL3736_I2C_ADDRESS_2)
+    is31fl3736_sw_shutdown(IS31FL3736_I2C_ADDRESS_2);
+#    if defined(IS31FL3736_I2C_ADDRESS_3)
+    is31fl3736_sw_shutdown(IS31FL3736_I2C_ADDRESS_3);
+#        if defined(IS31FL3736_I2C_ADDRESS_4)
+    is31fl3736_sw_shutdown(IS31FL3736_I2C_ADDRESS_4);
+#        endif
+#    endif
+#endif
+}
@@ -142,6 +142,11 @@ void is31fl3736_update_led_control_registers(uint8_t addr, uint8_t index);
 
 void is31fl3736_flush(void);
 
+void is31fl3736_sw_return_normal(uint8_t addr);
+void is31fl3736_sw_shutdown(uint8_t addr);
+void is31fl3736_sw_return_normal_drivers(void);
+void is31fl3736_sw_shutdown_drivers(void);
+
 #define IS31FL3736_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3736_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
 #define IS31FL3736_PDR_1K_OHM 0b010  // 1 kOhm resistor
@@ -61,9 +61,9 @@ uint8_t g_twi_transfer_buffer[20] = {0xFF};
 // We could optimize this and take out the unused registers from these
 // buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
-uint8_t g_pwm_buffer[IS31FL3741_DRIVER_COUNT][IS31FL3741_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[IS31FL3741_DRIVER_COUNT]        = {false};
-bool    g_scaling_registers_update_required[IS31FL3741_DRIVER_COUNT] = {false};
+uint8_t  g_pwm_buffer[IS31FL3741_DRIVER_COUNT][IS31FL3741_PWM_REGISTER_COUNT];
+uint32_t g_pwm_buffer_dirty_chunks[IS31FL3741_DRIVER_COUNT]           = {0};
+bool     g_scaling_registers_update_required[IS31FL3741_DRIVER_COUNT] = {false};
 
 uint8_t g_scaling_registers[IS31FL3741_DRIVER_COUNT][IS31FL3741_PWM_REGISTER_COUNT];
 
@@ -80,51 +80,49 @@ void is31fl3741_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-bool is31fl3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+// Sends the PWM buffer chunks flagged in dirty_chunks, one bit per 18 byte transfer
+static bool is31fl3741_write_pwm_chunks(uint8_t addr, uint8_t *pwm_buffer, uint32_t dirty_chunks) {
     // Assume PG0 is already selected
+    bool pg1_selected = false;
+
+    for (int i = 0; i < IS31FL3741_PWM_REGISTER_COUNT; i += 18) {
+        if (!(dirty_chunks & ((uint32_t)1 << (i / 18)))) {
+            continue;
+        }
 
-    for (int i = 0; i < 342; i += 18) {
-        if (i == 180) {
+        if (i >= 180 && !pg1_selected) {
             // unlock the command register and select PG1
             is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND_WRITE_LOCK, IS31FL3741_COMMAND_WRITE_LOCK_MAGIC);
             is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND, IS31FL3741_COMMAND_PWM_1);
+            pg1_selected = true;
         }
 
+        // the last transfer only carries the 9 registers left, as the total number is 351
+        uint8_t length = MIN(IS31FL3741_PWM_REGISTER_COUNT - i, 18);
+
         g_twi_transfer_buffer[0] = i % 180;
-        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, 18);
+        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, length);
 
 #if IS31FL3741_I2C_PERSISTENCE > 0
         for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, IS31FL3741_I2C_TIMEOUT) != 0) {
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, IS31FL3741_I2C_TIMEOUT) != 0) {
                 return false;
             }
         }
 #else
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, IS31FL3741_I2C_TIMEOUT) != 0) {
+        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, IS31FL3741_I2C_TIMEOUT) != 0) {
             return false;
         }
 #endif
     }
 
-    // transfer the left cause the total number is 351
-    g_twi_transfer_buffer[0] = 162;
-    memcpy(g_twi_transfer_buffer + 1, pwm_buffer + 342, 9);
-
-#if IS31FL3741_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, IS31FL3741_I2C_TIMEOUT) != 0) {
-            return false;
-        }
-    }
-#else
-    if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, IS31FL3741_I2C_TIMEOUT) != 0) {
-        return false;
-    }
-#endif
-
     return true;
 }
 
+bool is31fl3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    return is31fl3741_write_pwm_chunks(addr, pwm_buffer, UINT32_MAX);
+}
+
 void is31fl3741_init_drivers(void) {
     i2c_init();
 
@@ -192,10 +190,11 @@ void is31fl3741_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
             return;
         }
-        g_pwm_buffer_update_required[led.driver] = true;
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+
+        g_pwm_buffer_dirty_chunks[led.driver] |= ((uint32_t)1 << (led.r / 18)) | ((uint32_t)1 << (led.g / 18)) | ((uint32_t)1 << (led.b / 18));
     }
 }
 
@@ -231,15 +230,15 @@ void is31fl3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+    if (g_pwm_buffer_dirty_chunks[index]) {
         // unlock the command register and select PG2
         is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND_WRITE_LOCK, IS31FL3741_COMMAND_WRITE_LOCK_MAGIC);
         is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND, IS31FL3741_COMMAND_PWM_0);
 
-        is31fl3741_write_pwm_buffer(addr, g_pwm_buffer[index]);
+        is31fl3741_write_pwm_chunks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_chunks[index]);
     }
 
-    g_pwm_buffer_update_required[index] = false;
+    g_pwm_buffer_dirty_chunks[index] = 0;
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t red, uint8_t green, uint8_t blue) {
@@ -247,7 +246,7 @@ void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t red, uint8_
     g_pwm_buffer[pled->driver][pled->g] = green;
     g_pwm_buffer[pled->driver][pled->b] = blue;
 
-    g_pwm_buffer_update_required[pled->driver] = true;
+    g_pwm_buffer_dirty_chunks[pled->driver] |= ((uint32_t)1 << (pled->r / 18)) | ((uint32_t)1 << (pled->g / 18)) | ((uint32_t)1 << (pled->b / 18));
 }
 
 void is31fl3741_update_led_control_registers(uint8_t addr, uint8_t index) {
@@ -294,3 +293,51 @@ void is31fl3741_flush(void) {
 #    endif
 #endif
 }
+
+void is31fl3741_sw_return_normal(uint8_t addr) {
+    // Unlock the command register.
+    is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND_WRITE_LOCK, IS31FL3741_COMMAND_WRITE_LOCK_MAGIC);
+
+    // Select PG4
+    is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND, IS31FL3741_COMMAND_FUNCTION);
+
+    // Set to Normal operation
+    is31fl3741_write_register(addr, IS31FL3741_FUNCTION_REG_CONFIGURATION, IS31FL3741_CONFIGURATION);
+}
+
+void is31fl3741_sw_shutdown(uint8_t addr) {
+    // Unlock the command register.
+    is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND_WRITE_LOCK, IS31FL3741_COMMAND_WRITE_LOCK_MAGIC);
+
+    // Select PG4
+    is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND, IS31FL3741_COMMAND_FUNCTION);
+
+    // Clear the software shutdown bit, the scaling and PWM registers are kept
+    is31fl3741_write_register(addr, IS31FL3741_FUNCTION_REG_CONFIGURATION, IS31FL3741_CONFIGURATION & ~0x01);
+}
+
+void is31fl3741_sw_return_normal_drivers(void) {
+    is31fl3741_sw_return_normal(IS31FL3741_I2C_ADDRESS_1);
+#if defined(IS31FL3741_I2C_ADDRESS_2)
+    is31fl3741_sw_return_normal(IS31FL3741_I2C_ADDRESS_2);
+#    if defined(IS31FL3741_I2C_ADDRESS_3)
+    is31fl3741_sw_return_normal(IS31FL3741_I2C_ADDRESS_3);
+#        if defined(IS31FL3741_I2C_ADDRESS_4)
+    is31fl3741_sw_return_normal(IS31FL3741_I2C_ADDRESS_4);
+#        endif
+#    endif
+#endif
+}
+
+void is31fl3741_sw_shutdown_drivers(void) {
+    is31fl3741_sw_shutdown(IS31FL3741_I2C_ADDRESS_1);
+#if defined(IS31FL3741_I2C_ADDRESS_2)
+    is31fl3741_sw_shutdown(IS31FL3741_I2C_ADDRESS_2);
+#    if defined(IS31FL3741_I2C_ADDRESS_3)
+    is31fl3741_sw_shutdown(IS31FL3741_I2C_ADDRESS_3);
+#        if defined(IS31FL3741_I2C_ADDRESS_4)
+    is31fl3741_sw_shutdown(IS31FL3741_I2C_ADDRESS_4);
+#        endif
+#    endif
+#endif
+}
@@ -36,8 +36,8 @@ uint8_t g_twi_transfer_buffer[20];
 
 // These buffers match the PWM & scaling registers.
 // Storing them like this is optimal for I2C transfers to the registers.
-uint8_t g_pwm_buffer[DRIVER_COUNT][ISSI_MAX_LEDS];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+uint8_t  g_pwm_buffer[DRIVER_COUNT][ISSI_MAX_LEDS];
+uint16_t g_pwm_buffer_dirty_chunks[DRIVER_COUNT] = {0};
 
 uint8_t g_scaling_buffer[DRIVER_COUNT][ISSI_SCALING_SIZE];
 bool    g_scaling_buffer_update_required[DRIVER_COUNT] = {false};
@@ -120,14 +120,25 @@ void IS31FL_common_init(uint8_t addr, uint8_t ssr) {
     wait_ms(10);
 }
 
+// Each bit of g_pwm_buffer_dirty_chunks covers one ISSI_PWM_TRF_SIZE transfer of the PWM buffer
+_Static_assert((ISSI_MAX_LEDS + ISSI_PWM_TRF_SIZE - 1) / ISSI_PWM_TRF_SIZE <= 16, "Too many PWM transfers for the dirty chunk mask");
+
+static inline void IS31FL_mark_pwm_dirty(uint8_t driver, uint8_t reg) {
+    g_pwm_buffer_dirty_chunks[driver] |= (1 << (reg / ISSI_PWM_TRF_SIZE));
+}
+
 void IS31FL_common_update_pwm_register(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+    if (g_pwm_buffer_dirty_chunks[index]) {
         // Queue up the correct page
         IS31FL_unlock_register(addr, ISSI_PAGE_PWM);
-        // Hand off the update to IS31FL_write_multi_registers
-        IS31FL_write_multi_registers(addr, g_pwm_buffer[index], ISSI_MAX_LEDS, ISSI_PWM_TRF_SIZE, ISSI_PWM_REG_1ST);
+        // Hand off only the chunks that changed to IS31FL_write_multi_registers
+        for (int i = 0; i < ISSI_MAX_LEDS; i += ISSI_PWM_TRF_SIZE) {
+            if (g_pwm_buffer_dirty_chunks[index] & (1 << (i / ISSI_PWM_TRF_SIZE))) {
+                IS31FL_write_multi_registers(addr, g_pwm_buffer[index] + i, ISSI_PWM_TRF_SIZE, ISSI_PWM_TRF_SIZE, ISSI_PWM_REG_1ST + i);
+            }
+        }
         // Update flags that pwm_buffer has been updated
-        g_pwm_buffer_update_required[index] = false;
+        g_pwm_buffer_dirty_chunks[index] = 0;
     }
 }
 
@@ -187,6 +198,46 @@ void IS31FL_common_flush(void) {
 #endif
 }
 
+void IS31FL_common_sw_return_normal(uint8_t addr) {
+    // Unlock the command register & select Function Register
+    IS31FL_unlock_register(addr, ISSI_PAGE_FUNCTION);
+    // Set Configuration Register to remove Software shutdown
+    IS31FL_write_single_register(addr, ISSI_REG_CONFIGURATION, ISSI_CONFIGURATION);
+}
+
+void IS31FL_common_sw_shutdown(uint8_t addr) {
+    // Unlock the command register & select Function Register
+    IS31FL_unlock_register(addr, ISSI_PAGE_FUNCTION);
+    // Clear the Software shutdown bit, the scaling and PWM registers are kept
+    IS31FL_write_single_register(addr, ISSI_REG_CONFIGURATION, ISSI_CONFIGURATION & ~0x01);
+}
+
+void IS31FL_common_sw_return_normal_drivers(void) {
+    IS31FL_common_sw_return_normal(DRIVER_ADDR_1);
+#if defined(DRIVER_ADDR_2)
+    IS31FL_common_sw_return_normal(DRIVER_ADDR_2);
+#    if defined(DRIVER_ADDR_3)
+    IS31FL_common_sw_return_normal(DRIVER_ADDR_3);
+#        if defined(DRIVER_ADDR_4)
+    IS31FL_common_sw_return_normal(DRIVER_ADDR_4);
+#        endif
+#    endif
+#endif
+}
+
+void IS31FL_common_sw_shutdown_drivers(void) {
+    IS31FL_common_sw_shutdown(DRIVER_ADDR_1);
+#if defined(DRIVER_ADDR_2)
+    IS31FL_common_sw_shutdown(DRIVER_ADDR_2);
+#    if defined(DRIVER_ADDR_3)
+    IS31FL_common_sw_shutdown(DRIVER_ADDR_3);
+#        if defined(DRIVER_ADDR_4)
+    IS31FL_common_sw_shutdown(DRIVER_ADDR_4);
+#        endif
+#    endif
+#endif
+}
+
 #ifdef RGB_MATRIX_ENABLE
 void IS31FL_RGB_init_drivers(void) {
     i2c_init();
@@ -229,10 +280,16 @@ void IS31FL_RGB_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         is31_led led;
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
+            return;
+        }
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+
+        IS31FL_mark_pwm_dirty(led.driver, led.r);
+        IS31FL_mark_pwm_dirty(led.driver, led.g);
+        IS31FL_mark_pwm_dirty(led.driver, led.b);
     }
 }
 
@@ -317,8 +374,12 @@ void IS31FL_simple_set_brightness(int index, uint8_t value) {
         is31_led led;
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
+        if (g_pwm_buffer[led.driver][led.v] == value) {
+            return;
+        }
         g_pwm_buffer[led.driver][led.v] = value;
-        g_pwm_buffer_update_required[led.driver] = true;
+
+        IS31FL_mark_pwm_dirty(led.driver, led.v);
     }
 }
 
@@ -80,6 +80,11 @@ void IS31FL_common_update_scaling_register(uint8_t addr, uint8_t index);
 
 void IS31FL_common_flush(void);
 
+void IS31FL_common_sw_return_normal(uint8_t addr);
+void IS31FL_common_sw_shutdown(uint8_t addr);
+void IS31FL_common_sw_return_normal_drivers(void);
+void IS31FL_common_sw_shutdown_drivers(void);
+
 #ifdef RGB_MATRIX_ENABLE
 // RGB Matrix Specific scripts
 void IS31FL_RGB_init_drivers(void);
@@ -267,6 +267,8 @@ void snled27351_flush(void) {
 void snled27351_sw_return_normal(uint8_t addr) {
     // Select to function page
     snled27351_write_register(addr, SNLED27351_REG_COMMAND, SNLED27351_COMMAND_FUNCTION);
+    // Leave the sleep mode entered by snled27351_sw_shutdown()
+    snled27351_write_register(addr, SNLED27351_FUNCTION_REG_SOFTWARE_SLEEP, 0);
     // Setting LED driver to normal mode
     snled27351_write_register(addr, SNLED27351_FUNCTION_REG_SOFTWARE_SHUTDOWN, SNLED27351_SOFTWARE_SHUTDOWN_SSD_NORMAL);
 }
@@ -279,3 +281,29 @@ void snled27351_sw_shutdown(uint8_t addr) {
     // Write SW Sleep Register
     snled27351_write_register(addr, SNLED27351_FUNCTION_REG_SOFTWARE_SLEEP, SNLED27351_SOFTWARE_SLEEP_ENABLE);
 }
+
+void snled27351_sw_return_normal_drivers(void) {
+    snled27351_sw_return_normal(SNLED27351_I2C_ADDRESS_1);
+#if defined(SNLED27351_I2C_ADDRESS_2)
+    snled27351_sw_return_normal(SNLED27351_I2C_ADDRESS_2);
+#    if defined(SNLED27351_I2C_ADDRESS_3)
+    snled27351_sw_return_normal(SNLED27351_I2C_ADDRESS_3);
+#        if defined(SNLED27351_I2C_ADDRESS_4)
+    snled27351_sw_return_normal(SNLED27351_I2C_ADDRESS_4);
+#        endif
+#    endif
+#endif
+}
+
+void snled27351_sw_shutdown_drivers(void) {
+    snled27351_sw_shutdown(SNLED27351_I2C_ADDRESS_1);
+#if defined(SNLED27351_I2C_ADDRESS_2)
+    snled27351_sw_shutdown(SNLED27351_I2C_ADDRESS_2);
+#    if defined(SNLED27351_I2C_ADDRESS_3)
+    snled27351_sw_shutdown(SNLED27351_I2C_ADDRESS_3);
+#        if defined(SNLED27351_I2C_ADDRESS_4)
+    snled27351_sw_shutdown(SNLED27351_I2C_ADDRESS_4);
+#        endif
+#    endif
+#endif
+}
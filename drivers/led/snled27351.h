@@ -188,6 +188,8 @@ void snled27351_flush(void);
 
 void snled27351_sw_return_normal(uint8_t addr);
 void snled27351_sw_shutdown(uint8_t addr);
+void snled27351_sw_return_normal_drivers(void);
+void snled27351_sw_shutdown_drivers(void);
 
 #define A_1 0x00
 #define A_2 0x01
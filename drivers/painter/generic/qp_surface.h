@@ -21,6 +21,15 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty rectangles each RGB565 surface keeps track of.
+ *      Each one is transferred to the target display with its own viewport, so that unrelated areas of the surface
+ *      don't drag everything in between along with them. Setting this to 1 tracks a single bounding box instead.
+ */
+#    define SURFACE_DIRTY_RECTS 4
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -29,39 +29,147 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
-void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
+#if SURFACE_DIRTY_RECTS > 1
+
+// Whether two rects overlap, or are directly next to each other
+static inline bool qp_surface_dirty_rects_touch(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return a->l <= b->r + 1 && b->l <= a->r + 1 && a->t <= b->b + 1 && b->t <= a->b + 1;
+}
+
+static inline uint32_t qp_surface_dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (rect->b - rect->t + 1);
+}
+
+static inline void qp_surface_dirty_rect_union(surface_dirty_rect_t *target, const surface_dirty_rect_t *source) {
+    if (target->l > source->l) target->l = source->l;
+    if (target->t > source->t) target->t = source->t;
+    if (target->r < source->r) target->r = source->r;
+    if (target->b < source->b) target->b = source->b;
+}
+
+// The area that would needlessly be transferred if both rects were sent as their union
+static inline uint32_t qp_surface_dirty_rect_waste(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    surface_dirty_rect_t merged = *a;
+    qp_surface_dirty_rect_union(&merged, b);
+    return qp_surface_dirty_rect_area(&merged) - qp_surface_dirty_rect_area(a) - qp_surface_dirty_rect_area(b);
+}
+
+// Absorbs any other rects that the given rect now touches, so that the rects never overlap each other
+static void qp_surface_merge_dirty_rects(surface_dirty_data_t *dirty, uint8_t index) {
+    bool merged;
+    do {
+        merged = false;
+        for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+            if (i == index || !qp_surface_dirty_rects_touch(&dirty->rects[index], &dirty->rects[i])) {
+                continue;
+            }
+            qp_surface_dirty_rect_union(&dirty->rects[index], &dirty->rects[i]);
+
+            // Move the last rect into the freed slot
+            --dirty->num_rects;
+            dirty->rects[i] = dirty->rects[dirty->num_rects];
+            if (index == dirty->num_rects) {
+                index = i;
+            }
+            merged = true;
+            break;
+        }
+    } while (merged);
+}
+
+#endif // SURFACE_DIRTY_RECTS > 1
+
+// Maintains the bounding box of the dirty region
+static inline void qp_surface_update_dirty_bbox(surface_dirty_data_t *dirty, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    if (dirty->l > l) {
+        dirty->l        = l;
         dirty->is_dirty = true;
     }
-    if (dirty->r < x) {
-        dirty->r        = x;
+    if (dirty->r < r) {
+        dirty->r        = r;
         dirty->is_dirty = true;
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
+    if (dirty->t > t) {
+        dirty->t        = t;
         dirty->is_dirty = true;
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
+    if (dirty->b < b) {
+        dirty->b        = b;
         dirty->is_dirty = true;
     }
 }
 
+void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    qp_surface_update_dirty_bbox(dirty, x, y, x, y);
+}
+
+void qp_surface_update_dirty_rect(surface_dirty_data_t *dirty, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    qp_surface_update_dirty_bbox(dirty, l, t, r, b);
+
+#if SURFACE_DIRTY_RECTS > 1
+    surface_dirty_rect_t rect = {.l = l, .t = t, .r = r, .b = b};
+
+    // Grow an existing rect if the new one overlaps or adjoins it
+    for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+        surface_dirty_rect_t *existing = &dirty->rects[i];
+        if (existing->l <= l && existing->t <= t && existing->r >= r && existing->b >= b) {
+            return; // already covered
+        }
+        if (qp_surface_dirty_rects_touch(existing, &rect)) {
+            qp_surface_dirty_rect_union(existing, &rect);
+            qp_surface_merge_dirty_rects(dirty, i);
+            return;
+        }
+    }
+
+    // Otherwise keep it separate, if there's still room
+    if (dirty->num_rects < SURFACE_DIRTY_RECTS) {
+        dirty->rects[dirty->num_rects++] = rect;
+        return;
+    }
+
+    // Otherwise make room by combining whichever two rects, including the new one, waste the least area when merged
+    uint8_t  best_a     = 0;
+    uint8_t  best_b     = SURFACE_DIRTY_RECTS;
+    uint32_t best_waste = UINT32_MAX;
+    for (uint8_t a = 0; a < SURFACE_DIRTY_RECTS; ++a) {
+        for (uint8_t b = a + 1; b <= SURFACE_DIRTY_RECTS; ++b) {
+            uint32_t waste = qp_surface_dirty_rect_waste(&dirty->rects[a], b == SURFACE_DIRTY_RECTS ? &rect : &dirty->rects[b]);
+            if (waste < best_waste) {
+                best_a     = a;
+                best_b     = b;
+                best_waste = waste;
+            }
+        }
+    }
+
+    if (best_b == SURFACE_DIRTY_RECTS) {
+        qp_surface_dirty_rect_union(&dirty->rects[best_a], &rect);
+    } else {
+        qp_surface_dirty_rect_union(&dirty->rects[best_a], &dirty->rects[best_b]);
+        dirty->rects[best_b] = rect;
+    }
+    qp_surface_merge_dirty_rects(dirty, best_a);
+#endif // SURFACE_DIRTY_RECTS > 1
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver vtable
 
 bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
+    memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, surface->buffer_height, driver->native_bits_per_pixel));
 
     surface->dirty.l        = 0;
     surface->dirty.t        = 0;
     surface->dirty.r        = surface->base.panel_width - 1;
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
+#if SURFACE_DIRTY_RECTS > 1
+    surface->dirty.num_rects = 1;
+    surface->dirty.rects[0]  = (surface_dirty_rect_t){.l = surface->dirty.l, .t = surface->dirty.t, .r = surface->dirty.r, .b = surface->dirty.b};
+#endif // SURFACE_DIRTY_RECTS > 1
 
     return true;
 }
@@ -83,6 +191,9 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+#if SURFACE_DIRTY_RECTS > 1
+    surface->dirty.num_rects = 0;
+#endif // SURFACE_DIRTY_RECTS > 1
     return true;
 }
 
@@ -16,12 +16,27 @@ typedef struct surface_painter_driver_vtable_t {
     bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
 } surface_painter_driver_vtable_t;
 
+typedef struct surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_rect_t;
+
 typedef struct surface_dirty_data_t {
-    bool     is_dirty;
+    bool is_dirty;
+
+    // Bounding box of everything drawn since the last flush
     uint16_t l;
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+#    if SURFACE_DIRTY_RECTS > 1
+    // Separate areas within the bounding box, so that the space between them doesn't need to be transferred
+    uint8_t              num_rects;
+    surface_dirty_rect_t rects[SURFACE_DIRTY_RECTS];
+#    endif // SURFACE_DIRTY_RECTS > 1
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -47,6 +62,10 @@ typedef struct surface_painter_device_t {
         uint16_t *u16buffer;
     };
 
+    // Rows of the surface held in the buffer -- a tiled renderer only keeps one band of its RGB565 surface in RAM at a time
+    uint16_t buffer_top;
+    uint16_t buffer_height;
+
     // Manually manage the viewport for streaming pixel data to the display
     surface_viewport_data_t viewport;
 
@@ -88,7 +107,10 @@ bool qp_surface_clear(painter_device_t device);
 bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
+// Only grows the bounding box -- used by surfaces whose flush only reads the bounding box, e.g. mono1bpp
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+// Grows the bounding box and the list of dirty rects, which is what's transferred to the target for RGB565 surfaces
+void qp_surface_update_dirty_rect(surface_dirty_data_t *dirty, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
@@ -109,6 +131,8 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
                 driver->base.offset_x              = 0;                                                                                                                       \
                 driver->base.offset_y              = 0;                                                                                                                       \
                 driver->buffer                     = buffer;                                                                                                                  \
+                driver->buffer_top                 = 0;                                                                                                                       \
+                driver->buffer_height              = panel_height;                                                                                                            \
                 return (painter_device_t)driver;                                                                                                                              \
             }                                                                                                                                                                 \
         }                                                                                                                                                                     \
@@ -40,16 +40,33 @@ static inline void setpixel_mono1bpp(surface_painter_device_t *surface, uint16_t
     }
 }
 
-static inline void append_pixel_mono1bpp(surface_painter_device_t *surface, bool mono_pixel) {
-    setpixel_mono1bpp(surface, surface->viewport.pixdata_x, surface->viewport.pixdata_y, mono_pixel);
-    qp_surface_increment_pixdata_location(&surface->viewport);
-}
-
 static inline void stream_pixdata_mono1bpp(surface_painter_device_t *surface, const uint8_t *data, uint32_t native_pixel_count) {
-    for (uint32_t pixel_counter = 0; pixel_counter < native_pixel_count; ++pixel_counter) {
-        uint32_t byte_offset = pixel_counter / 8;
-        uint8_t  bit_offset  = pixel_counter % 8;
-        append_pixel_mono1bpp(surface, (data[byte_offset] & (1 << bit_offset)) ? true : false);
+    surface_viewport_data_t *viewport      = &surface->viewport;
+    uint32_t                 pixel_counter = 0;
+
+    while (pixel_counter < native_pixel_count) {
+        // Write whatever fits on the remainder of the current viewport row in one go
+        uint16_t x           = viewport->pixdata_x;
+        uint16_t y           = viewport->pixdata_y;
+        uint32_t span_length = viewport->viewport_r - x + 1;
+        if (span_length > native_pixel_count - pixel_counter) {
+            span_length = native_pixel_count - pixel_counter;
+        }
+        for (uint32_t i = 0; i < span_length; ++i, ++pixel_counter) {
+            uint32_t byte_offset = pixel_counter / 8;
+            uint8_t  bit_offset  = pixel_counter % 8;
+            setpixel_mono1bpp(surface, x + i, y, (data[byte_offset] & (1 << bit_offset)) ? true : false);
+        }
+
+        // Move the write location past the span, wrapping the same way as qp_surface_increment_pixdata_location()
+        viewport->pixdata_x += span_length;
+        if (viewport->pixdata_x > viewport->viewport_r) {
+            viewport->pixdata_x = viewport->viewport_l;
+            viewport->pixdata_y++;
+        }
+        if (viewport->pixdata_y > viewport->viewport_b) {
+            viewport->pixdata_y = viewport->viewport_t;
+        }
     }
 }
 
@@ -69,17 +86,37 @@ static bool qp_surface_palette_convert_mono1bpp(painter_device_t device, int16_t
     return true;
 }
 
+static inline void append_pixel_mono1bpp(uint8_t *target_buffer, uint32_t pixel_num, bool mono_pixel) {
+    uint32_t byte_offset = pixel_num / 8;
+    uint8_t  bit_offset  = pixel_num % 8;
+    if (mono_pixel) {
+        target_buffer[byte_offset] |= (1 << bit_offset);
+    } else {
+        target_buffer[byte_offset] &= ~(1 << bit_offset);
+    }
+}
+
 // Append pixels to the target location, keyed by the pixel index
 static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
-    for (uint32_t i = 0; i < pixel_count; ++i) {
-        uint32_t pixel_num   = pixel_offset + i;
-        uint32_t byte_offset = pixel_num / 8;
-        uint8_t  bit_offset  = pixel_num % 8;
-        if (palette[palette_indices[i]].mono) {
-            target_buffer[byte_offset] |= (1 << bit_offset);
-        } else {
-            target_buffer[byte_offset] &= ~(1 << bit_offset);
+    uint32_t i = 0;
+
+    // Set individual bits up to the next byte boundary...
+    for (; i < pixel_count && ((pixel_offset + i) % 8) != 0; ++i) {
+        append_pixel_mono1bpp(target_buffer, pixel_offset + i, palette[palette_indices[i]].mono);
+    }
+
+    // ...then write whole bytes at a time...
+    for (; i + 8 <= pixel_count; i += 8) {
+        uint8_t byteval = 0;
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            byteval |= (palette[palette_indices[i + bit]].mono ? 1 : 0) << bit;
         }
+        target_buffer[(pixel_offset + i) / 8] = byteval;
+    }
+
+    // ...and set whatever is left over
+    for (; i < pixel_count; ++i) {
+        append_pixel_mono1bpp(target_buffer, pixel_offset + i, palette[palette_indices[i]].mono);
     }
     return true;
 }
@@ -5,39 +5,60 @@
 
 #    include "color.h"
 #    include "qp_draw.h"
+#    include "qp_comms.h"
 #    include "qp_surface_internal.h"
 #    include "qp_comms_dummy.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Surface driver impl: rgb565
 
-static inline void setpixel_rgb565(surface_painter_device_t *surface, uint16_t x, uint16_t y, uint16_t rgb565) {
-    uint16_t w = surface->base.panel_width;
-    uint16_t h = surface->base.panel_height;
-
-    // Drop out if it's off-screen
-    if (x >= w || y >= h) {
-        return;
-    }
-
-    // Skip messing with the dirty info if the original value already matches
-    if (surface->u16buffer[y * w + x] != rgb565) {
-        // Update the dirty region
-        qp_surface_update_dirty(&surface->dirty, x, y);
+static inline void stream_pixdata_rgb565(surface_painter_device_t *surface, const uint16_t *data, uint32_t native_pixel_count) {
+    surface_viewport_data_t *viewport = &surface->viewport;
+    uint16_t                 w        = surface->base.panel_width;
+    uint16_t                 top      = surface->buffer_top;
+    uint16_t                 bottom   = surface->buffer_top + surface->buffer_height;
+
+    while (native_pixel_count > 0) {
+        // Copy whatever fits on the remainder of the current viewport row in one go
+        uint16_t x           = viewport->pixdata_x;
+        uint16_t y           = viewport->pixdata_y;
+        uint32_t span_length = viewport->viewport_r - x + 1;
+        if (span_length > native_pixel_count) {
+            span_length = native_pixel_count;
+        }
 
-        // Update the pixel data in the buffer
-        surface->u16buffer[y * w + x] = rgb565;
-    }
-}
+        // Skip anything off-screen or outside of the buffered rows, and only mark the changed part of the row as dirty
+        if (x < w && y >= top && y < bottom) {
+            uint16_t *row   = &surface->u16buffer[(y - top) * w];
+            uint32_t  end   = (x + span_length < w) ? (x + span_length) : w;
+            uint32_t  first = end;
+            uint32_t  last  = 0;
+            for (uint32_t i = x; i < end; ++i) {
+                if (row[i] != data[i - x]) {
+                    row[i] = data[i - x];
+                    if (first == end) {
+                        first = i;
+                    }
+                    last = i;
+                }
+            }
+            if (first != end) {
+                qp_surface_update_dirty_rect(&surface->dirty, first, y, last, y);
+            }
+        }
 
-static inline void append_pixel_rgb565(surface_painter_device_t *surface, uint16_t rgb565) {
-    setpixel_rgb565(surface, surface->viewport.pixdata_x, surface->viewport.pixdata_y, rgb565);
-    qp_surface_increment_pixdata_location(&surface->viewport);
-}
+        data += span_length;
+        native_pixel_count -= span_length;
 
-static inline void stream_pixdata_rgb565(surface_painter_device_t *surface, const uint16_t *data, uint32_t native_pixel_count) {
-    for (uint32_t pixel_counter = 0; pixel_counter < native_pixel_count; ++pixel_counter) {
-        append_pixel_rgb565(surface, data[pixel_counter]);
+        // Move the write location past the span, wrapping the same way as qp_surface_increment_pixdata_location()
+        viewport->pixdata_x += span_length;
+        if (viewport->pixdata_x > viewport->viewport_r) {
+            viewport->pixdata_x = viewport->viewport_l;
+            viewport->pixdata_y++;
+        }
+        if (viewport->pixdata_y > viewport->viewport_b) {
+            viewport->pixdata_y = viewport->viewport_t;
+        }
     }
 }
 
@@ -61,62 +82,85 @@ static bool qp_surface_palette_convert_rgb565_swapped(painter_device_t device, i
 
 // Append pixels to the target location, keyed by the pixel index
 static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
-    uint16_t *buf = (uint16_t *)target_buffer;
+    uint16_t *buf = ((uint16_t *)target_buffer) + pixel_offset;
     for (uint32_t i = 0; i < pixel_count; ++i) {
-        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+        buf[i] = palette[palette_indices[i]].rgb565;
     }
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
-
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
-
+// Sends one rectangle of the surface to the target, assumes the target's comms are already running
+static bool rgb565_target_pixdata_transfer_rect(surface_painter_device_t *surface_handle, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     // Set the target drawing area
-    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
+    bool ok = target_driver->driver_vtable->viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
         qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
         return false;
     }
 
     // Housekeeping of the amount of pixels to transfer
-    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
+    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_handle->base.native_bits_per_pixel;
     uint32_t  pixel_counter     = 0;
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
     // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = t; y <= b; ++y) {
+    for (uint16_t y = t; y <= b && ok; ++y) {
         for (uint16_t x = l; x <= r; ++x) {
             // Update the target buffer
-            target_buffer[pixel_counter++] = surface_handle->u16buffer[y * surface_handle->base.panel_width + x];
+            target_buffer[pixel_counter++] = surface_handle->u16buffer[(y - surface_handle->buffer_top) * surface_handle->base.panel_width + x];
 
             // If we've accumulated enough data, send it
             if (pixel_counter == total_pixel_count) {
-                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+                ok = qp_internal_send_pixdata((painter_device_t)target_driver, pixel_counter);
                 if (!ok) {
                     qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-                    return false;
+                    break;
                 }
-                // Reset the counter
+                // Reset the counter, and continue in the next pixdata buffer
                 pixel_counter = 0;
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
             }
         }
     }
 
     // If there's any leftover data, send it
-    if (pixel_counter > 0) {
-        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+    if (ok && pixel_counter > 0) {
+        ok = qp_internal_send_pixdata((painter_device_t)target_driver, pixel_counter);
         if (!ok) {
             qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-            return false;
         }
     }
 
-    return true;
+    return ok;
+}
+
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    surface_dirty_data_t *    dirty          = &surface_handle->dirty;
+
+    // Keep comms running for the whole transfer, so that each chunk can be filled while the previous one is still being sent
+    if (!qp_comms_start((painter_device_t)target_driver)) {
+        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not start target comms)\n");
+        return false;
+    }
+
+    bool ok;
+    if (entire_surface) {
+        ok = rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, 0, surface_handle->buffer_top, surface_driver->panel_width - 1, surface_handle->buffer_top + surface_handle->buffer_height - 1);
+    } else {
+#if SURFACE_DIRTY_RECTS > 1
+        // Each dirty rect gets its own viewport, skipping the untouched areas in between
+        ok = true;
+        for (uint8_t i = 0; i < dirty->num_rects && ok; ++i) {
+            ok = rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, dirty->rects[i].l, dirty->rects[i].t, dirty->rects[i].r, dirty->rects[i].b);
+        }
+#else
+        ok = rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, dirty->l, dirty->t, dirty->r, dirty->b);
+#endif // SURFACE_DIRTY_RECTS > 1
+    }
+
+    qp_comms_stop((painter_device_t)target_driver);
+    return ok;
 }
 
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
@@ -0,0 +1,363 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+
+#    include "qp_draw.h"
+#    include "qp_comms_dummy.h"
+#    include "qp_tiled_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Display list
+
+// Common to all commands -- the area is clipped to the panel, and used to skip the command for bands it doesn't touch
+typedef struct QP_PACKED tiled_command_header_t {
+    uint8_t  type;
+    uint16_t length; // of the whole command, including this header
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} tiled_command_header_t;
+
+typedef struct QP_PACKED tiled_shape_command_t {
+    tiled_command_header_t header;
+    uint16_t               args[4];
+    uint8_t                hue;
+    uint8_t                sat;
+    uint8_t                val;
+    bool                   filled;
+} tiled_shape_command_t;
+
+typedef struct QP_PACKED tiled_image_command_t {
+    tiled_command_header_t header;
+    uint16_t               x;
+    uint16_t               y;
+    painter_image_handle_t image;
+    uint16_t               frame_number;
+    qp_pixel_t             fg_hsv888;
+    qp_pixel_t             bg_hsv888;
+} tiled_image_command_t;
+
+typedef struct QP_PACKED tiled_text_command_t {
+    tiled_command_header_t header;
+    uint16_t               x;
+    uint16_t               y;
+    painter_font_handle_t  font;
+    qp_pixel_t             fg_hsv888;
+    qp_pixel_t             bg_hsv888;
+    char                   str[]; // NUL-terminated copy, as the caller's string may not live until the list is drawn
+} tiled_text_command_t;
+
+#    define for_each_tiled_command(tiled, command) for (tiled_command_header_t *command = (tiled_command_header_t *)(tiled)->display_list; (uint8_t *)command < (tiled)->display_list + (tiled)->display_list_length; command = (tiled_command_header_t *)((uint8_t *)command + command->length))
+
+// Reserves space for a command at the end of the display list. Sets *command to NULL if the command is entirely off the panel, as it doesn't need recording.
+static bool qp_tiled_append_command(tiled_painter_device_t *tiled, tiled_command_header_t **command, qp_tiled_command_type_t type, size_t length, int32_t l, int32_t t, int32_t r, int32_t b) {
+    *command = NULL;
+    if (r < 0 || b < 0 || l >= tiled->base.panel_width || t >= tiled->base.panel_height) {
+        return true;
+    }
+
+    if (length > UINT16_MAX || tiled->display_list_length + length > tiled->display_list_size) {
+        qp_dprintf("qp_tiled_append_command: fail (display list is full)\n");
+        return false;
+    }
+
+    tiled_command_header_t *header = (tiled_command_header_t *)&tiled->display_list[tiled->display_list_length];
+    tiled->display_list_length += length;
+
+    header->type   = type;
+    header->length = length;
+    header->l      = QP_MAX(l, 0);
+    header->t      = QP_MAX(t, 0);
+    header->r      = QP_MIN(r, tiled->base.panel_width - 1);
+    header->b      = QP_MIN(b, tiled->base.panel_height - 1);
+    *command       = header;
+    return true;
+}
+
+static bool qp_tiled_replay_command(painter_device_t band, const tiled_command_header_t *command) {
+    const tiled_shape_command_t *shape = (const tiled_shape_command_t *)command;
+    const tiled_image_command_t *image = (const tiled_image_command_t *)command;
+    const tiled_text_command_t * text  = (const tiled_text_command_t *)command;
+    switch (command->type) {
+        case QP_TILED_SETPIXEL:
+            return qp_setpixel(band, shape->args[0], shape->args[1], shape->hue, shape->sat, shape->val);
+        case QP_TILED_LINE:
+            return qp_line(band, shape->args[0], shape->args[1], shape->args[2], shape->args[3], shape->hue, shape->sat, shape->val);
+        case QP_TILED_RECT:
+            return qp_rect(band, shape->args[0], shape->args[1], shape->args[2], shape->args[3], shape->hue, shape->sat, shape->val, shape->filled);
+        case QP_TILED_CIRCLE:
+            return qp_circle(band, shape->args[0], shape->args[1], shape->args[2], shape->hue, shape->sat, shape->val, shape->filled);
+        case QP_TILED_ELLIPSE:
+            return qp_ellipse(band, shape->args[0], shape->args[1], shape->args[2], shape->args[3], shape->hue, shape->sat, shape->val, shape->filled);
+        case QP_TILED_IMAGE:
+            return qp_internal_drawimage_frame(band, image->x, image->y, image->image, image->frame_number, image->fg_hsv888, image->bg_hsv888);
+        case QP_TILED_TEXT:
+            return qp_drawtext_recolor(band, text->x, text->y, text->font, text->str, text->fg_hsv888.hsv888.h, text->fg_hsv888.hsv888.s, text->fg_hsv888.hsv888.v, text->bg_hsv888.hsv888.h, text->bg_hsv888.hsv888.s, text->bg_hsv888.hsv888.v) > 0;
+    }
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Recording API
+
+bool qp_tiled_record_shape(painter_device_t device, qp_tiled_command_type_t type, uint16_t arg0, uint16_t arg1, uint16_t arg2, uint16_t arg3, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    tiled_painter_device_t *tiled = (tiled_painter_device_t *)device;
+
+    int32_t l, t, r, b;
+    switch (type) {
+        case QP_TILED_CIRCLE:
+            l = (int32_t)arg0 - arg2;
+            t = (int32_t)arg1 - arg2;
+            r = (int32_t)arg0 + arg2;
+            b = (int32_t)arg1 + arg2;
+            break;
+        case QP_TILED_ELLIPSE:
+            l = (int32_t)arg0 - arg2;
+            t = (int32_t)arg1 - arg3;
+            r = (int32_t)arg0 + arg2;
+            b = (int32_t)arg1 + arg3;
+            break;
+        default:
+            l = QP_MIN(arg0, arg2);
+            t = QP_MIN(arg1, arg3);
+            r = QP_MAX(arg0, arg2);
+            b = QP_MAX(arg1, arg3);
+            break;
+    }
+
+    tiled_command_header_t *header;
+    if (!qp_tiled_append_command(tiled, &header, type, sizeof(tiled_shape_command_t), l, t, r, b)) {
+        return false;
+    }
+    if (header) {
+        tiled_shape_command_t *command = (tiled_shape_command_t *)header;
+        command->args[0]               = arg0;
+        command->args[1]               = arg1;
+        command->args[2]               = arg2;
+        command->args[3]               = arg3;
+        command->hue                   = hue;
+        command->sat                   = sat;
+        command->val                   = val;
+        command->filled                = filled;
+    }
+    return true;
+}
+
+bool qp_tiled_record_image(painter_device_t device, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b, painter_image_handle_t image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    tiled_painter_device_t *tiled = (tiled_painter_device_t *)device;
+    tiled_command_header_t *header;
+    if (!qp_tiled_append_command(tiled, &header, QP_TILED_IMAGE, sizeof(tiled_image_command_t), l, t, r, b)) {
+        return false;
+    }
+    if (header) {
+        tiled_image_command_t *command = (tiled_image_command_t *)header;
+        command->x                     = x;
+        command->y                     = y;
+        command->image                 = image;
+        command->frame_number          = frame_number;
+        command->fg_hsv888             = fg_hsv888;
+        command->bg_hsv888             = bg_hsv888;
+    }
+    return true;
+}
+
+int16_t qp_tiled_record_text(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    tiled_painter_device_t *tiled = (tiled_painter_device_t *)device;
+    int16_t                 width = qp_textwidth(font, str);
+    if (width <= 0) {
+        return 0;
+    }
+
+    size_t                  str_size = strlen(str) + 1;
+    tiled_command_header_t *header;
+    if (!qp_tiled_append_command(tiled, &header, QP_TILED_TEXT, sizeof(tiled_text_command_t) + str_size, x, y, (int32_t)x + width - 1, (int32_t)y + font->line_height - 1)) {
+        return 0;
+    }
+    if (header) {
+        tiled_text_command_t *command = (tiled_text_command_t *)header;
+        command->x                    = x;
+        command->y                    = y;
+        command->font                 = font;
+        command->fg_hsv888            = fg_hsv888;
+        command->bg_hsv888            = bg_hsv888;
+        memcpy(command->str, str, str_size);
+    }
+    return width;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver vtable
+
+static bool qp_tiled_init(painter_device_t device, painter_rotation_t rotation) {
+    tiled_painter_device_t *tiled = (tiled_painter_device_t *)device;
+    tiled->display_list_length    = 0;
+    return qp_init((painter_device_t)&tiled->band, QP_ROTATION_0);
+}
+
+static bool qp_tiled_power(painter_device_t device, bool power_on) {
+    // No-op.
+    return true;
+}
+
+static bool qp_tiled_clear(painter_device_t device) {
+    painter_driver_t *      driver = (painter_driver_t *)device;
+    tiled_painter_device_t *tiled  = (tiled_painter_device_t *)driver;
+
+    // Anything recorded so far would only be drawn over, but the whole panel still needs blanking
+    tiled->display_list_length = 0;
+    return qp_tiled_record_shape(device, QP_TILED_RECT, 0, 0, driver->panel_width - 1, driver->panel_height - 1, 0, 0, 0, true);
+}
+
+static bool qp_tiled_flush(painter_device_t device) {
+    tiled_painter_device_t *tiled = (tiled_painter_device_t *)device;
+    tiled->display_list_length    = 0;
+    return true;
+}
+
+static bool qp_tiled_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    // Raw pixel data can't be recorded compactly
+    qp_dprintf("qp_tiled_viewport: fail (not supported by tiled renderers)\n");
+    return false;
+}
+
+static bool qp_tiled_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    qp_dprintf("qp_tiled_pixdata: fail (not supported by tiled renderers)\n");
+    return false;
+}
+
+// Pixel conversion is the band's, as that's where everything is eventually drawn
+static bool qp_tiled_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    painter_driver_t *band = (painter_driver_t *)&((tiled_painter_device_t *)device)->band;
+    return band->driver_vtable->palette_convert((painter_device_t)band, palette_size, palette);
+}
+
+static bool qp_tiled_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    painter_driver_t *band = (painter_driver_t *)&((tiled_painter_device_t *)device)->band;
+    return band->driver_vtable->append_pixels((painter_device_t)band, target_buffer, palette, pixel_offset, pixel_count, palette_indices);
+}
+
+static bool qp_tiled_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    painter_driver_t *band = (painter_driver_t *)&((tiled_painter_device_t *)device)->band;
+    return band->driver_vtable->append_pixdata((painter_device_t)band, target_buffer, pixdata_offset, pixdata_byte);
+}
+
+static const painter_driver_vtable_t tiled_driver_vtable = {
+    .init            = qp_tiled_init,
+    .power           = qp_tiled_power,
+    .clear           = qp_tiled_clear,
+    .flush           = qp_tiled_flush,
+    .pixdata         = qp_tiled_pixdata,
+    .viewport        = qp_tiled_viewport,
+    .palette_convert = qp_tiled_palette_convert,
+    .append_pixels   = qp_tiled_append_pixels,
+    .append_pixdata  = qp_tiled_append_pixdata,
+};
+
+bool qp_tiled_is_device(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    return driver->driver_vtable == &tiled_driver_vtable;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver storage
+
+tiled_painter_device_t tiled_drivers[TILED_NUM_DEVICES] = {0};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Factory function for creating a handle to a tiled renderer
+
+painter_device_t qp_make_rgb565_tiled(uint16_t panel_width, uint16_t panel_height, uint16_t band_height, void *band_buffer, void *display_list, size_t display_list_size) {
+    for (uint32_t i = 0; i < TILED_NUM_DEVICES; ++i) {
+        tiled_painter_device_t *driver = &tiled_drivers[i];
+        if (!driver->base.driver_vtable) {
+            // The band is a full size surface, with only the rows of the current band held in its buffer
+            if (!qp_make_rgb565_surface_advanced(&driver->band, 1, panel_width, panel_height, band_buffer)) {
+                return NULL;
+            }
+            driver->band.buffer_height = QP_MIN(band_height, panel_height);
+
+            driver->base.driver_vtable         = &tiled_driver_vtable;
+            driver->base.native_bits_per_pixel = 16;
+            driver->base.comms_vtable          = &dummy_comms_vtable;
+            driver->base.panel_width           = panel_width;
+            driver->base.panel_height          = panel_height;
+            driver->base.rotation              = QP_ROTATION_0;
+            driver->base.offset_x              = 0;
+            driver->base.offset_y              = 0;
+            driver->display_list               = (uint8_t *)display_list;
+            driver->display_list_size          = display_list_size;
+            driver->display_list_length        = 0;
+            return (painter_device_t)driver;
+        }
+    }
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Drawing routine to render the display list band by band, and send it to another device
+
+bool qp_tiled_draw(painter_device_t tiled, painter_device_t display, uint16_t x, uint16_t y) {
+    painter_driver_t *      tiled_driver   = (painter_driver_t *)tiled;
+    tiled_painter_device_t *tiled_handle   = (tiled_painter_device_t *)tiled_driver;
+    painter_driver_t *      display_driver = (painter_driver_t *)display;
+    if (!tiled_driver || !tiled_driver->validate_ok || !qp_tiled_is_device(tiled)) {
+        qp_dprintf("qp_tiled_draw: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // If we have incompatible bit depths, drop out
+    if (tiled_driver->native_bits_per_pixel != display_driver->native_bits_per_pixel) {
+        qp_dprintf("qp_tiled_draw: fail (incompatible bpp: tiled=%d, target=%d)\n", (int)tiled_driver->native_bits_per_pixel, (int)display_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    // Only the rows that were drawn to need rendering
+    uint16_t top    = UINT16_MAX;
+    uint16_t bottom = 0;
+    for_each_tiled_command(tiled_handle, command) {
+        top    = QP_MIN(top, command->t);
+        bottom = QP_MAX(bottom, command->b);
+    }
+
+    surface_painter_device_t *band        = &tiled_handle->band;
+    uint16_t                  band_height = band->buffer_height;
+    bool                      ok          = true;
+    for (uint32_t band_top = top; band_top <= bottom && ok; band_top += band_height) {
+        uint16_t band_bottom = QP_MIN(band_top + band_height - 1, bottom);
+
+        // Start the band from black, and replay everything that touches it -- anything outside of the band's rows is discarded
+        band->buffer_top = band_top;
+        memset(band->buffer, 0, TILED_REQUIRED_BAND_BUFFER_BYTE_SIZE(tiled_driver->panel_width, band_height));
+        for_each_tiled_command(tiled_handle, command) {
+            if (command->t <= band_bottom && command->b >= band_top && !qp_tiled_replay_command((painter_device_t)band, command)) {
+                qp_dprintf("qp_tiled_draw: fail (could not replay command type %d)\n", (int)command->type);
+                ok = false;
+                break;
+            }
+        }
+
+        // Send the areas that were drawn to, even where they stayed black
+        qp_flush((painter_device_t)band);
+        for_each_tiled_command(tiled_handle, command) {
+            if (command->t <= band_bottom && command->b >= band_top) {
+                qp_surface_update_dirty_rect(&band->dirty, command->l, QP_MAX(command->t, band_top), command->r, QP_MIN(command->b, band_bottom));
+            }
+        }
+        if (ok && !qp_surface_draw((painter_device_t)band, display, x, y, false)) {
+            qp_dprintf("qp_tiled_draw: fail (could not send band at row %d)\n", (int)band_top);
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        return false;
+    }
+
+    tiled_handle->display_list_length = 0;
+    qp_dprintf("qp_tiled_draw: ok\n");
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_TILED_ENABLE
@@ -0,0 +1,60 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "qp_internal.h"
+#include "qp_surface.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter tiled renderer helpers
+
+// Helper for determining the buffer size required for the band of an RGB565 tiled renderer
+#define TILED_REQUIRED_BAND_BUFFER_BYTE_SIZE(w, band_height) SURFACE_REQUIRED_BUFFER_BYTE_SIZE(w, band_height, 16)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter tiled renderer configurables (add to your keyboard's config.h)
+
+#ifndef TILED_NUM_DEVICES
+/**
+ * @def This controls the maximum number of tiled renderers that Quantum Painter can use at any one time.
+ *      Each requires its own band buffer and display list.
+ */
+#    define TILED_NUM_DEVICES 1
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Forward declarations
+
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+
+/**
+ * Factory method for an RGB565 tiled renderer.
+ *
+ * Drawing to the returned device records the draw calls into the display list. They are rendered by \ref qp_tiled_draw,
+ * one horizontal band at a time, so only a band of the panel needs to be held in RAM.
+ *
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param band_height[in] the number of rows rendered at a time
+ * @param band_buffer[in] pointer to a preallocated uint8_t buffer of size `TILED_REQUIRED_BAND_BUFFER_BYTE_SIZE(panel_width, band_height)`
+ * @param display_list[in] pointer to a preallocated uint8_t buffer, used to record the draw calls
+ * @param display_list_size[in] the size of the display list buffer, in bytes
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_make_rgb565_tiled(uint16_t panel_width, uint16_t panel_height, uint16_t band_height, void *band_buffer, void *display_list, size_t display_list_size);
+
+/**
+ * Renders everything drawn to a tiled renderer, and sends it to the display.
+ *
+ * Each band is rendered on top of a black background, and only the areas that were drawn to are sent. After successful
+ * completion, the display list is emptied.
+ *
+ * @param tiled[in] the tiled renderer to render
+ * @param display[in] the display to send the rendered bands to
+ * @param x[in] the x-location of the rendered area on the target display
+ * @param y[in] the y-location of the rendered area on the target display
+ * @return whether the draw operation completed successfully
+ */
+bool qp_tiled_draw(painter_device_t tiled, painter_device_t display, uint16_t x, uint16_t y);
+
+#endif // QUANTUM_PAINTER_TILED_ENABLE
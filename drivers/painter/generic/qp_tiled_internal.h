@@ -0,0 +1,51 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+
+#    include "qp_tiled.h"
+#    include "qp_surface_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Internal declarations
+
+typedef enum qp_tiled_command_type_t {
+    QP_TILED_SETPIXEL,
+    QP_TILED_LINE,
+    QP_TILED_RECT,
+    QP_TILED_CIRCLE,
+    QP_TILED_ELLIPSE,
+    QP_TILED_IMAGE,
+    QP_TILED_TEXT,
+} qp_tiled_command_type_t;
+
+// Tiled renderer struct
+typedef struct tiled_painter_device_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    // The band currently being rendered, as a surface only holding the band's rows in its buffer
+    surface_painter_device_t band;
+
+    // The recorded draw calls
+    uint8_t *display_list;
+    size_t   display_list_size;
+    size_t   display_list_length;
+} tiled_painter_device_t;
+
+// Driver storage
+extern tiled_painter_device_t tiled_drivers[TILED_NUM_DEVICES];
+
+// Whether draw calls to the device need to be recorded by one of the functions below
+bool qp_tiled_is_device(painter_device_t device);
+
+// Records qp_setpixel, qp_line, qp_rect, qp_circle, or qp_ellipse -- the arguments are the coordinates/sizes in the order the matching qp_* function takes them
+bool qp_tiled_record_shape(painter_device_t device, qp_tiled_command_type_t type, uint16_t arg0, uint16_t arg1, uint16_t arg2, uint16_t arg3, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+// Records a frame of an image, which covers l/t/r/b on the panel
+bool qp_tiled_record_image(painter_device_t device, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b, painter_image_handle_t image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888);
+
+// Records a copy of the string, returning its width like qp_drawtext_recolor
+int16_t qp_tiled_record_text(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888);
+
+#endif // QUANTUM_PAINTER_TILED_ENABLE
@@ -81,7 +81,12 @@ bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top,
 // Stream pixel data to the current write position in GRAM
 bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
     painter_driver_t *driver = (painter_driver_t *)device;
+#if QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT > 1
+    // The next pixdata buffer is filled while this one is sent
+    qp_comms_send_async(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
+#else
     qp_comms_send(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
+#endif
     return true;
 }
 
@@ -111,9 +116,9 @@ bool qp_tft_panel_palette_convert_rgb888(painter_device_t device, int16_t palett
 // Append pixels to the target location, keyed by the pixel index
 
 bool qp_tft_panel_append_pixels_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
-    uint16_t *buf = (uint16_t *)target_buffer;
+    uint16_t *buf = ((uint16_t *)target_buffer) + pixel_offset;
     for (uint32_t i = 0; i < pixel_count; ++i) {
-        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+        buf[i] = palette[palette_indices[i]].rgb565;
     }
     return true;
 }
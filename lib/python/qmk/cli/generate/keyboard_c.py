@@ -1,5 +1,7 @@
 """Used by the make system to generate keyboard.c from info.json.
 """
+from math import isqrt
+
 from milc import cli
 
 from qmk.info import info_json
@@ -8,6 +10,9 @@ from qmk.keyboard import keyboard_completer, keyboard_folder
 from qmk.path import normpath
 from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
 
+# Must match the default RGB_MATRIX_TYPING_HEATMAP_SPREAD in typing_heatmap_anim.h
+TYPING_HEATMAP_SPREAD = 40
+
 
 def _gen_led_config(info_data):
     """Convert info.json content to g_led_config
@@ -52,6 +57,56 @@ def _gen_led_config(info_data):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    if config_type == 'rgb_matrix':
+        lines.extend(_gen_typing_heatmap_neighbors(info_data))
+    lines.append('#endif')
+
+    return lines
+
+
+def _gen_typing_heatmap_neighbors(info_data):
+    """Convert info.json content to the neighbors of each key for the typing heatmap effect
+    """
+    cols = info_data['matrix_size']['cols']
+    rows = info_data['matrix_size']['rows']
+
+    # Keys with an LED, as placed in g_led_config.matrix_co, truncated to whole numbers like the uint8_t LED positions
+    keys = {}
+    for led_data in info_data['rgb_matrix']['layout']:
+        if 'matrix' in led_data:
+            keys[tuple(led_data['matrix'])] = (int(led_data.get('x', 0)), int(led_data.get('y', 0)))
+
+    index = [0]
+    neighbors = []
+    for row in range(rows):
+        for col in range(cols):
+            if (row, col) in keys:
+                x, y = keys[(row, col)]
+                found = []
+                for (n_row, n_col), (n_x, n_y) in keys.items():
+                    if (n_row, n_col) == (row, col):
+                        continue
+                    # Same as sqrt16() on the LED positions
+                    distance = min(isqrt((x - n_x)**2 + (y - n_y)**2), 255)
+                    # Keys at the edge of the spread would get no heat
+                    if distance < TYPING_HEATMAP_SPREAD:
+                        found.append((distance, n_row, n_col))
+                neighbors.extend(f'{{{n_row}, {n_col}, {distance}}}' for distance, n_row, n_col in sorted(found))
+            index.append(len(neighbors))
+
+    lines = []
+    if not neighbors:
+        return lines
+
+    lines.append(f'#if defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP) && !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM) && (!defined(RGB_MATRIX_TYPING_HEATMAP_SPREAD) || RGB_MATRIX_TYPING_HEATMAP_SPREAD <= {TYPING_HEATMAP_SPREAD})')
+    lines.append('const uint16_t g_typing_heatmap_neighbor_index[] PROGMEM = {')
+    for i in range(0, len(index), cols):
+        lines.append(f'  {", ".join(str(n) for n in index[i:i + cols])},')
+    lines.append('};')
+    lines.append('const led_neighbor_t g_typing_heatmap_neighbors[] PROGMEM = {')
+    for i in range(0, len(neighbors), 8):
+        lines.append(f'  {", ".join(neighbors[i:i + 8])},')
+    lines.append('};')
     lines.append('#endif')
 
     return lines
@@ -136,6 +136,7 @@ class QFFUnicodeGlyphTableV1:
         self.header.length = len(self.glyphs.keys()) * 6
         self.header.write(fp)
 
+        # Glyphs are looked up with a binary search, so they must be written in ascending code point order
         for n in sorted(self.glyphs.keys()):
             self.glyphs[n].write(fp, True)
 
@@ -79,3 +79,11 @@ typedef uint8_t pin_t;
 #define readPin(pin) ((PORT->Group[SAMD_PORT(pin)].IN.reg & SAMD_PIN_MASK(pin)) != 0)
 
 #define togglePin(pin) (PORT->Group[SAMD_PORT(pin)].OUTTGL.reg = SAMD_PIN_MASK(pin))
+
+/* Operation of GPIO by port. */
+
+typedef uint32_t port_mask_t;
+
+#define getPinPort(pin) ((pin)&0x20)
+#define getPinPad(pin) SAMD_PIN(pin)
+#define readPinPort(pin) (PORT->Group[SAMD_PORT(pin)].IN.reg)
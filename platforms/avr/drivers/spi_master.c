@@ -151,6 +151,13 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+// There is no DMA on AVR, so the transfer has already finished when this returns
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    return spi_transmit(data, length);
+}
+
+void spi_transmit_wait(void) {}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
@@ -51,6 +51,10 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+void spi_transmit_wait(void);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
 void spi_stop(void);
@@ -36,3 +36,11 @@ typedef uint8_t pin_t;
 #define readPin(pin) ((bool)(PINx_ADDRESS(pin) & _BV((pin)&0xF)))
 
 #define togglePin(pin) (PORTx_ADDRESS(pin) ^= _BV((pin)&0xF))
+
+/* Operation of GPIO by port. */
+
+typedef uint8_t port_mask_t;
+
+#define getPinPort(pin) ((pin)&0xF0)
+#define getPinPad(pin) ((pin)&0xF)
+#define readPinPort(pin) PINx_ADDRESS(pin)
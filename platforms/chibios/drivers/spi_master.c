@@ -293,6 +293,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 
 spi_status_t spi_write(uint8_t data) {
     uint8_t rxData;
+    spi_transmit_wait();
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
     return rxData;
@@ -300,23 +301,49 @@ spi_status_t spi_write(uint8_t data) {
 
 spi_status_t spi_read(void) {
     uint8_t data = 0;
+    spi_transmit_wait();
     spiReceive(&SPI_DRIVER, 1, &data);
 
     return data;
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_transmit_wait(void) {
+    osalSysLock();
+#if SPI_USE_WAIT == TRUE
+    // The completion interrupt wakes up the waiting thread, and can't fire between the state check and the suspend
+    if (SPI_DRIVER.state == SPI_ACTIVE) {
+        osalThreadSuspendS(&SPI_DRIVER.thread);
+    }
+#else
+    while (SPI_DRIVER.state == SPI_ACTIVE) {
+        osalSysUnlock();
+        osalSysLock();
+    }
+#endif
+    osalSysUnlock();
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_transmit_wait();
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
         if (currentSlavePin != NO_PIN) {
             writePinHigh(currentSlavePin);
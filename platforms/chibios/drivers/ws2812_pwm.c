@@ -291,22 +291,81 @@ typedef uint16_t ws2812_buffer_t;
 typedef uint8_t ws2812_buffer_t;
 #endif
 
-static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
-
-/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+#ifdef WS2812_PWM_DOUBLE_BUFFER
 /*
- * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
- * the memory (while the DMA is reading/writing from/to a buffer, the application can
- * write/read to/from the other buffer).
+ * Double buffered mode: instead of a circular DMA transfer that continuously reads the frame
+ * being written, every frame is sent once. Frames are encoded into the back buffer while the
+ * DMA reads the front one, and the transfer complete interrupt starts the next frame.
  */
+#    define WS2812_PWM_BUFFER_COUNT 2
+#    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
+#        define WS2812_DMA_TRANSFER_MODE WB32_DMA_CHCFG_TCIE
+#    else
+#        define WS2812_DMA_TRANSFER_MODE STM32_DMA_CR_TCIE
+#    endif
+#else
+#    define WS2812_PWM_BUFFER_COUNT 1
+#    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
+#        define WS2812_DMA_TRANSFER_MODE (WB32_DMA_CHCFG_CIRC | WB32_DMA_CHCFG_TCIE)
+#    else
+#        define WS2812_DMA_TRANSFER_MODE STM32_DMA_CR_CIRC
+#    endif
+#endif
+
+static ws2812_buffer_t  ws2812_frame_buffers[WS2812_PWM_BUFFER_COUNT][WS2812_BIT_N + 1]; /**< Buffers for a frame */
+static ws2812_buffer_t* ws2812_frame_buffer = ws2812_frame_buffers[0];                   /**< Buffer written by ws2812_write_led() */
+
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+static volatile bool ws2812_dma_busy    = false;
+static volatile bool ws2812_dma_pending = false;
+
+static void ws2812_dma_start(ws2812_buffer_t* buffer) {
+    dmaStreamDisable(WS2812_DMA_STREAM);
+#    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
+    dmaStreamSetSource(WS2812_DMA_STREAM, buffer);
+#    else
+    dmaStreamSetMemory0(WS2812_DMA_STREAM, buffer);
+#    endif
+    dmaStreamSetTransactionSize(WS2812_DMA_STREAM, WS2812_BIT_N);
+    dmaStreamEnable(WS2812_DMA_STREAM);
+}
+
+/* Swaps the buffers, so the frame that was just written gets sent and the other one is free */
+static void ws2812_swap_buffers(void) {
+    ws2812_buffer_t* front = ws2812_frame_buffer;
+    ws2812_frame_buffer    = (front == ws2812_frame_buffers[0]) ? ws2812_frame_buffers[1] : ws2812_frame_buffers[0];
+    ws2812_dma_start(front);
+}
+
+static void ws2812_dma_callback(void* p, uint32_t flags) {
+    (void)p;
+    (void)flags;
+
+    osalSysLockFromISR();
+    if (ws2812_dma_pending) {
+        ws2812_dma_pending = false;
+        ws2812_swap_buffers();
+    } else {
+        ws2812_dma_busy = false;
+    }
+    osalSysUnlockFromISR();
+}
+#    define WS2812_DMA_CALLBACK ws2812_dma_callback
+#else
+#    define WS2812_DMA_CALLBACK NULL
+#endif
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
 void ws2812_init(void) {
-    // Initialize led frame buffer
-    uint32_t i;
-    for (i = 0; i < WS2812_COLOR_BIT_N; i++)
-        ws2812_frame_buffer[i] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
-    for (i = 0; i < WS2812_RESET_BIT_N; i++)
-        ws2812_frame_buffer[i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
+    // Initialize led frame buffers
+    for (uint8_t b = 0; b < WS2812_PWM_BUFFER_COUNT; b++) {
+        uint32_t i;
+        for (i = 0; i < WS2812_COLOR_BIT_N; i++)
+            ws2812_frame_buffers[b][i] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
+        for (i = 0; i < WS2812_RESET_BIT_N; i++)
+            ws2812_frame_buffers[b][i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
+    }
 
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 
@@ -329,15 +388,15 @@ void ws2812_init(void) {
     // Configure DMA
     // dmaInit(); // Joe added this
 #if defined(WB32F3G71xx) || defined(WB32FQ95xx)
-    dmaStreamAlloc(WS2812_DMA_STREAM - WB32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_DMA_STREAM - WB32_DMA_STREAM(0), 10, WS2812_DMA_CALLBACK, NULL);
     dmaStreamSetSource(WS2812_DMA_STREAM, ws2812_frame_buffer);
     dmaStreamSetDestination(WS2812_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
-    dmaStreamSetMode(WS2812_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_CIRC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3));
+    dmaStreamSetMode(WS2812_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WS2812_DMA_TRANSFER_MODE | WB32_DMA_CHCFG_PL(3));
 #else
-    dmaStreamAlloc(WS2812_DMA_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_DMA_STREAM - STM32_DMA_STREAM(0), 10, WS2812_DMA_CALLBACK, NULL);
     dmaStreamSetPeripheral(WS2812_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
     dmaStreamSetMemory0(WS2812_DMA_STREAM, ws2812_frame_buffer);
-    dmaStreamSetMode(WS2812_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_DMA_PERIPHERAL_WIDTH | WS2812_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3));
+    dmaStreamSetMode(WS2812_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_DMA_PERIPHERAL_WIDTH | WS2812_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | WS2812_DMA_TRANSFER_MODE | STM32_DMA_CR_PL(3));
 #endif
     dmaStreamSetTransactionSize(WS2812_DMA_STREAM, WS2812_BIT_N);
     // M2P: Memory 2 Periph; PL: Priority Level
@@ -348,7 +407,9 @@ void ws2812_init(void) {
 #endif
 
     // Start DMA
+#ifndef WS2812_PWM_DOUBLE_BUFFER
     dmaStreamEnable(WS2812_DMA_STREAM);
+#endif // otherwise the first frame is sent by ws2812_setleds()
 
     // Configure PWM
     // NOTE: It's required that preload be enabled on the timer channel CCR register. This is currently enabled in the
@@ -386,6 +447,13 @@ void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+    // Keep the interrupt from picking up the back buffer while it is being written
+    osalSysLock();
+    ws2812_dma_pending = false;
+    osalSysUnlock();
+#endif
+
     for (uint16_t i = 0; i < leds; i++) {
 #ifdef RGBW
         ws2812_write_led_rgbw(i, ledarray[i].r, ledarray[i].g, ledarray[i].b, ledarray[i].w);
@@ -393,4 +461,16 @@ void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
         ws2812_write_led(i, ledarray[i].r, ledarray[i].g, ledarray[i].b);
 #endif
     }
+
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+    osalSysLock();
+    if (ws2812_dma_busy) {
+        // sent by the transfer complete interrupt once the current frame is out
+        ws2812_dma_pending = true;
+    } else {
+        ws2812_dma_busy = true;
+        ws2812_swap_buffers();
+    }
+    osalSysUnlock();
+#endif
 }
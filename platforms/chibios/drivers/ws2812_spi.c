@@ -85,8 +85,43 @@
 #define DATA_SIZE (BYTES_FOR_LED * WS2812_LED_COUNT)
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+// Double buffering: frames are encoded into the back buffer while the previous
+// frame is still being sent from the front one, and the SPI completion callback
+// starts the next frame.
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+#    if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#        error "WS2812_SPI_DOUBLE_BUFFER cannot be combined with WS2812_SPI_USE_CIRCULAR_BUFFER or WS2812_SPI_SYNC"
+#    endif
+#    define WS2812_SPI_BUFFER_COUNT 2
+#else
+#    define WS2812_SPI_BUFFER_COUNT 1
+#endif
+
+static uint8_t txbuf[WS2812_SPI_BUFFER_COUNT][TXBUF_SIZE] = {0};
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+static volatile uint8_t tx_front   = 0;
+static volatile bool    tx_busy    = false;
+static volatile bool    tx_pending = false;
+
+static void ws2812_spi_end_cb(SPIDriver* spip) {
+    osalSysLockFromISR();
+    if (tx_pending) {
+        // the back buffer holds a complete frame, make it the front one
+        tx_pending = false;
+        tx_front ^= 1;
+        spiStartSendI(spip, TXBUF_SIZE, txbuf[tx_front]);
+    } else {
+        tx_busy = false;
+    }
+    osalSysUnlockFromISR();
+}
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#else
+#    define WS2812_SPI_END_CB NULL
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
@@ -106,8 +141,8 @@ static uint8_t get_protocol_eq(uint8_t data, int pos) {
     return eq;
 }
 
-static void set_led_color_rgb(rgb_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static void set_led_color_rgb(uint8_t* buf, rgb_led_t color, int pos) {
+    uint8_t* tx_start = &buf[PREAMBLE_SIZE];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
     for (int j = 0; j < 4; j++)
@@ -151,7 +186,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -170,8 +205,8 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
-        NULL, // error_cb
+        WS2812_SPI_END_CB, // data_cb
+        NULL,              // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
         WS2812_SPI_DIVISOR_CR1_BR_X,
@@ -183,7 +218,7 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
 #endif
 }
 
@@ -194,17 +229,40 @@ void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+    // Keep the callback from picking up the back buffer while it is being encoded
+    osalSysLock();
+    tx_pending = false;
+    osalSysUnlock();
+
+    uint8_t back = tx_front ^ 1;
+    for (uint8_t i = 0; i < leds; i++) {
+        set_led_color_rgb(txbuf[back], ledarray[i], i);
+    }
+
+    osalSysLock();
+    if (tx_busy) {
+        // sent by the completion callback once the current frame is out
+        tx_pending = true;
+    } else {
+        tx_busy  = true;
+        tx_front = back;
+        spiStartSendI(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[back]);
+    }
+    osalSysUnlock();
+#else
     for (uint8_t i = 0; i < leds; i++) {
-        set_led_color_rgb(ledarray[i], i);
+        set_led_color_rgb(txbuf[0], ledarray[i], i);
     }
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
     // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
-#    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+#    ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+#        ifdef WS2812_SPI_SYNC
+    spiSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
+#        else
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
+#        endif
 #    endif
 #endif
 }
@@ -43,3 +43,11 @@ typedef ioline_t pin_t;
 #define readPin(pin) palReadLine(pin)
 
 #define togglePin(pin) palToggleLine(pin)
+
+/* Operation of GPIO by port. */
+
+typedef ioportmask_t port_mask_t;
+
+#define getPinPort(pin) PAL_LINE(PAL_PORT(pin), 0)
+#define getPinPad(pin) PAL_PAD(pin)
+#define readPinPort(pin) palReadPort(PAL_PORT(pin))
@@ -0,0 +1,80 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+#include <string.h>
+#include "eeprom_i2c_mock.h"
+#include "i2c_master.h"
+#include "eeprom.h"
+#include "timer.h"
+
+static uint8_t  memory[EXTERNAL_EEPROM_BYTE_COUNT];
+static uint32_t address_pointer = 0;
+static uint32_t busy_until      = 0;
+static uint32_t page_writes     = 0;
+static uint32_t nacks           = 0;
+
+void mock_eeprom_reset(void) {
+    memset(memory, 0, sizeof(memory));
+    address_pointer = 0;
+    busy_until      = 0;
+    page_writes     = 0;
+    nacks           = 0;
+}
+
+uint8_t *mock_eeprom_memory(void) {
+    return memory;
+}
+
+uint32_t mock_eeprom_page_writes(void) {
+    return page_writes;
+}
+
+uint32_t mock_eeprom_nacks(void) {
+    return nacks;
+}
+
+static bool mock_eeprom_busy(void) {
+    if ((int32_t)(timer_read32() - busy_until) < 0) {
+        nacks++;
+        return true;
+    }
+    return false;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (address != EXTERNAL_EEPROM_I2C_BASE_ADDRESS || length < EXTERNAL_EEPROM_ADDRESS_SIZE || mock_eeprom_busy()) {
+        return I2C_STATUS_ERROR;
+    }
+
+    address_pointer = 0;
+    for (uint8_t i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; i++) {
+        address_pointer = (address_pointer << 8) | data[i];
+    }
+    address_pointer %= EXTERNAL_EEPROM_BYTE_COUNT;
+
+    if (length > EXTERNAL_EEPROM_ADDRESS_SIZE) {
+        // Like the real thing, wraps around within the page rather than moving on to the next
+        uint32_t page = address_pointer - address_pointer % EXTERNAL_EEPROM_PAGE_SIZE;
+        for (uint16_t i = EXTERNAL_EEPROM_ADDRESS_SIZE; i < length; i++) {
+            memory[page + (address_pointer + i - EXTERNAL_EEPROM_ADDRESS_SIZE) % EXTERNAL_EEPROM_PAGE_SIZE] = data[i];
+        }
+        page_writes++;
+        busy_until = timer_read32() + MOCK_EEPROM_WRITE_TIME;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (address != EXTERNAL_EEPROM_I2C_BASE_ADDRESS || mock_eeprom_busy()) {
+        return I2C_STATUS_ERROR;
+    }
+
+    for (uint16_t i = 0; i < length; i++) {
+        data[i]         = memory[address_pointer];
+        address_pointer = (address_pointer + 1) % EXTERNAL_EEPROM_BYTE_COUNT;
+    }
+    return I2C_STATUS_SUCCESS;
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/* Simulated 24xx series I2C EEPROM, with the geometry configured in eeprom_i2c.h.
+ * The device does not acknowledge anything for MOCK_EEPROM_WRITE_TIME ms after a write. */
+#ifndef MOCK_EEPROM_WRITE_TIME
+#    define MOCK_EEPROM_WRITE_TIME 3
+#endif
+
+void     mock_eeprom_reset(void);
+uint8_t *mock_eeprom_memory(void);
+uint32_t mock_eeprom_page_writes(void);
+uint32_t mock_eeprom_nacks(void);
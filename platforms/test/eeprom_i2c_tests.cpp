@@ -0,0 +1,139 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <iomanip>
+#include <iostream>
+
+extern "C" {
+#include "eeprom.h"
+#include "eeprom_driver.h"
+#include "eeprom_i2c_mock.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class EepromI2c : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(1000);
+        mock_eeprom_reset();
+        eeprom_driver_init();
+    }
+
+    void TearDown() override {
+        eeprom_driver_flush();
+    }
+
+    /* one main loop iteration, as far as the EEPROM driver is concerned */
+    void idle_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            eeprom_driver_task();
+            advance_time(1);
+        }
+    }
+};
+
+TEST_F(EepromI2c, ReadBack) {
+    uint8_t data[100];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i + 1;
+    }
+    eeprom_write_block(data, (void *)20, sizeof(data));
+
+    uint8_t read[sizeof(data)] = {0};
+    eeprom_read_block(read, (void *)20, sizeof(read));
+    EXPECT_EQ(memcmp(read, data, sizeof(data)), 0);
+
+    eeprom_driver_flush();
+    EXPECT_EQ(memcmp(&mock_eeprom_memory()[20], data, sizeof(data)), 0);
+    EXPECT_EQ(mock_eeprom_memory()[19], 0);
+    EXPECT_EQ(mock_eeprom_memory()[120], 0);
+}
+
+TEST_F(EepromI2c, PreservesUnwrittenBytes) {
+    for (uint8_t i = 0; i < EXTERNAL_EEPROM_PAGE_SIZE; i++) {
+        mock_eeprom_memory()[EXTERNAL_EEPROM_PAGE_SIZE + i] = 0xA0 + i;
+    }
+
+    eeprom_write_byte((uint8_t *)EXTERNAL_EEPROM_PAGE_SIZE + 2, 0x11);
+    eeprom_write_byte((uint8_t *)EXTERNAL_EEPROM_PAGE_SIZE + 9, 0x22);
+    EXPECT_EQ(eeprom_read_byte((uint8_t *)EXTERNAL_EEPROM_PAGE_SIZE + 5), 0xA5);
+    EXPECT_EQ(eeprom_read_byte((uint8_t *)EXTERNAL_EEPROM_PAGE_SIZE + 9), 0x22);
+    eeprom_driver_flush();
+
+    for (uint8_t i = 0; i < EXTERNAL_EEPROM_PAGE_SIZE; i++) {
+        uint8_t expected = i == 2 ? 0x11 : i == 9 ? 0x22 : 0xA0 + i;
+        EXPECT_EQ(mock_eeprom_memory()[EXTERNAL_EEPROM_PAGE_SIZE + i], expected) << "offset " << (int)i;
+    }
+}
+
+TEST_F(EepromI2c, Erase) {
+    eeprom_write_byte((uint8_t *)7, 0x55);
+    mock_eeprom_memory()[EXTERNAL_EEPROM_BYTE_COUNT - 1] = 0x66;
+    eeprom_driver_erase();
+    eeprom_driver_flush();
+    EXPECT_EQ(eeprom_read_byte((uint8_t *)7), 0);
+    EXPECT_EQ(mock_eeprom_memory()[7], 0);
+    EXPECT_EQ(mock_eeprom_memory()[EXTERNAL_EEPROM_BYTE_COUNT - 1], 0);
+}
+
+#if defined(EXTERNAL_EEPROM_WRITE_QUEUE)
+TEST_F(EepromI2c, CoalescesPageWrites) {
+    for (uint8_t i = 0; i < EXTERNAL_EEPROM_PAGE_SIZE; i++) {
+        eeprom_update_byte((uint8_t *)(2 * EXTERNAL_EEPROM_PAGE_SIZE) + i, i + 1);
+    }
+    EXPECT_EQ(mock_eeprom_page_writes(), 0);
+
+    idle_for(1);
+    EXPECT_EQ(mock_eeprom_page_writes(), 1);
+    idle_for(EXTERNAL_EEPROM_WRITE_TIME * 2);
+    EXPECT_EQ(mock_eeprom_page_writes(), 1);
+    EXPECT_EQ(mock_eeprom_memory()[3 * EXTERNAL_EEPROM_PAGE_SIZE - 1], EXTERNAL_EEPROM_PAGE_SIZE);
+}
+
+TEST_F(EepromI2c, WritesDoNotBlock) {
+    uint32_t start = timer_read32();
+    for (uint16_t i = 0; i < EXTERNAL_EEPROM_PAGE_SIZE * EXTERNAL_EEPROM_WRITE_QUEUE_PAGES; i++) {
+        eeprom_update_byte((uint8_t *)i, 0x5A);
+    }
+    EXPECT_EQ(timer_read32() - start, 0);
+
+    /* one page per task, as soon as the device acknowledges again */
+    idle_for(EXTERNAL_EEPROM_WRITE_QUEUE_PAGES * (MOCK_EEPROM_WRITE_TIME + 1));
+    EXPECT_EQ(mock_eeprom_page_writes(), EXTERNAL_EEPROM_WRITE_QUEUE_PAGES);
+    EXPECT_EQ(mock_eeprom_memory()[EXTERNAL_EEPROM_PAGE_SIZE * EXTERNAL_EEPROM_WRITE_QUEUE_PAGES - 1], 0x5A);
+}
+#endif
+
+TEST_F(EepromI2c, Benchmark) {
+    /* A 1KiB keymap upload, in 28 byte packets written a byte at a time like dynamic_keymap_set_buffer(),
+     * with one main loop iteration between packets. */
+    static const uint16_t SIZE   = 1024;
+    static const uint16_t PACKET = 28;
+
+    uint32_t blocked = 0;
+    uint32_t start   = timer_read32();
+    for (uint16_t offset = 0; offset < SIZE; offset += PACKET) {
+        uint32_t t = timer_read32();
+        for (uint16_t i = offset; i < offset + PACKET && i < SIZE; i++) {
+            eeprom_update_byte((uint8_t *)i, (uint8_t)(i * 7 + 1));
+        }
+        blocked += timer_read32() - t;
+        idle_for(1);
+    }
+    while (mock_eeprom_page_writes() < SIZE / EXTERNAL_EEPROM_PAGE_SIZE) {
+        idle_for(1);
+    }
+    uint32_t t = timer_read32();
+    eeprom_driver_flush();
+    blocked += timer_read32() - t;
+
+    std::cout << "[ EEPROM   ] " << SIZE << " bytes  page writes " << std::setw(5) << mock_eeprom_page_writes() << "  blocked " << std::setw(5) << blocked << "ms  total " << std::setw(5) << timer_read32() - start << "ms" << std::endl;
+    for (uint16_t i = 0; i < SIZE; i++) {
+        ASSERT_EQ(mock_eeprom_memory()[i], (uint8_t)(i * 7 + 1));
+    }
+}
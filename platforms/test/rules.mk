@@ -23,3 +23,19 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+eeprom_i2c_DEFS := -DEEPROM_DRIVER -DEEPROM_I2C -DEEPROM_I2C_24LC64 -DNO_PRINT
+eeprom_i2c_queue_DEFS := $(eeprom_i2c_DEFS) -DEXTERNAL_EEPROM_WRITE_QUEUE
+
+eeprom_i2c_INC := \
+	$(TOP_DIR)/drivers/eeprom \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+eeprom_i2c_queue_INC := $(eeprom_i2c_INC)
+
+eeprom_i2c_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_i2c.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_i2c_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_i2c_mock.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+eeprom_i2c_queue_SRC := $(eeprom_i2c_SRC)
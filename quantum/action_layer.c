@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -316,16 +317,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Resolve layer
  *
- * Gets the layer based on key info
+ * Finds the topmost active layer where the key is not transparent
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t layer_switch_resolve_layer(layer_state_t layers, keypos_t key) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -337,6 +337,52 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+#    define LAYER_LOOKUP_CACHE_EMPTY 0xFF
+
+/** \brief layer lookup cache
+ *
+ * Resolved layer of each matrix position, valid for the layer state it was filled in
+ */
+static uint8_t       layer_lookup_cache[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t layer_lookup_cache_state;
+static bool          layer_lookup_cache_valid = false;
+
+/** \brief Layer lookup cache clear
+ *
+ * Must be called when the keymap changes at runtime, layer state changes are detected automatically
+ */
+void layer_lookup_cache_clear(void) {
+    layer_lookup_cache_valid = false;
+}
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_LOOKUP_CACHE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        if (!layer_lookup_cache_valid || layer_lookup_cache_state != layers) {
+            memset(layer_lookup_cache, LAYER_LOOKUP_CACHE_EMPTY, sizeof(layer_lookup_cache));
+            layer_lookup_cache_state = layers;
+            layer_lookup_cache_valid = true;
+        }
+
+        uint8_t *cached = &layer_lookup_cache[key.row][key.col];
+        if (*cached == LAYER_LOOKUP_CACHE_EMPTY) {
+            *cached = layer_switch_resolve_layer(layers, key);
+        }
+        return *cached;
+    }
+#    endif
+    return layer_switch_resolve_layer(layers, key);
 #else
     return get_highest_layer(default_layer_state);
 #endif
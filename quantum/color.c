@@ -97,6 +97,70 @@ RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
     return rgb;
 }
 
+/*
+ * Channel assignment for each hue sector, as indices into {v, x, p} for red, green and blue,
+ * where x is q in the odd and t in the even sectors. Sector 6 only holds h = 255 and matches
+ * sector 0, like the switch in hsv_to_rgb_impl().
+ */
+static const uint8_t hue_sectors[7][3] PROGMEM = {
+    {0, 1, 2}, // r = v, g = t, b = p
+    {1, 0, 2}, // r = q, g = v, b = p
+    {2, 0, 1}, // r = p, g = v, b = t
+    {2, 1, 0}, // r = p, g = q, b = v
+    {1, 2, 0}, // r = t, g = p, b = v
+    {0, 2, 1}, // r = v, g = p, b = q
+    {0, 1, 2}, // r = v, g = t, b = p
+};
+
+void hsv_to_rgb_batch_impl(const HSV *hsv, RGB *rgb, uint16_t count, bool use_cie) {
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t v = hsv[i].v;
+#ifdef USE_CIE1931_CURVE
+        if (use_cie) {
+            v = pgm_read_byte(&CIE1931_CURVE[v]);
+        }
+#endif
+
+        uint8_t s = hsv[i].s;
+        if (s == 0) {
+            rgb[i].r = v;
+            rgb[i].g = v;
+            rgb[i].b = v;
+            continue;
+        }
+
+        // Same results as hsv_to_rgb_impl(), but h * 6 / 255 without the division, and only the
+        // one of q and t that the sector actually uses.
+        uint8_t h         = hsv[i].h;
+        uint8_t region    = (h * 193) >> 13;
+        uint8_t remainder = (h * 2 - region * 85) * 3;
+        uint8_t w         = (region & 1) ? remainder : 255 - remainder;
+
+#if UINTPTR_MAX > 0xFFFF
+        // Both products fit in 16 bits, so they can share a single 32 bit multiplication
+        uint32_t products = v * ((uint32_t)(255 - s) | ((uint32_t)(255 - ((s * w) >> 8)) << 16));
+        uint8_t  p        = products >> 8;
+        uint8_t  x        = products >> 24;
+#else
+        uint8_t p = (v * (255 - s)) >> 8;
+        uint8_t x = (v * (255 - ((s * w) >> 8))) >> 8;
+#endif
+
+        uint8_t channels[3] = {v, x, p};
+        rgb[i].r            = channels[pgm_read_byte(&hue_sectors[region][0])];
+        rgb[i].g            = channels[pgm_read_byte(&hue_sectors[region][1])];
+        rgb[i].b            = channels[pgm_read_byte(&hue_sectors[region][2])];
+    }
+}
+
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint16_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_batch_impl(hsv, rgb, count, true);
+#else
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+#endif
+}
+
 RGB hsv_to_rgb(HSV hsv) {
 #ifdef USE_CIE1931_CURVE
     return hsv_to_rgb_impl(hsv, true);
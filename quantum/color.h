@@ -111,6 +111,8 @@ typedef struct PACKED HSV {
 
 RGB hsv_to_rgb(HSV hsv);
 RGB hsv_to_rgb_nocie(HSV hsv);
+/* converts count values at once, with the same results as calling hsv_to_rgb() on each */
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint16_t count);
 #ifdef RGBW
 void convert_rgb_to_rgbw(rgb_led_t *led);
 #endif
@@ -0,0 +1,176 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm with the same behaviour as sym_defer_pk, but without a
+per-key counter. Keys that start bouncing in the same scan share a queue entry holding
+their start time and a row bitmask. Because every key waits for the same DEBOUNCE
+period, the queue is ordered by deadline, so each scan only looks at the oldest entry.
+A scan without any bouncing keys costs no more than checking an empty queue, and
+starting or cancelling timers only touches the rows that changed.
+
+When more keys start bouncing than the queue can hold, the queue is collapsed into one
+entry per row, restarting every pending key's timer. This only ever delays a change,
+it never pushes one early.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <stdlib.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Queue entries per matrix row, the queue is collapsed if this is exceeded
+#ifndef DEBOUNCE_QUEUE_ENTRIES_PER_ROW
+#    define DEBOUNCE_QUEUE_ENTRIES_PER_ROW 2
+#endif
+
+#if DEBOUNCE > 0
+typedef struct {
+    fast_timer_t start;
+    uint8_t      row;
+    matrix_row_t mask;
+} debounce_entry_t;
+
+static debounce_entry_t *debounce_queue;
+static matrix_row_t *    debounce_pending;
+static uint8_t           queue_size;
+static uint8_t           queue_head;
+static uint8_t           queue_count;
+
+#    define QUEUE_INDEX(i) (((queue_head) + (i)) % queue_size)
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    uint16_t size = (uint16_t)num_rows * DEBOUNCE_QUEUE_ENTRIES_PER_ROW;
+    if (size < 2 * num_rows) {
+        // collapsing needs room for one entry per row, plus the rows changing in this scan
+        size = 2 * num_rows;
+    }
+    if (size > UINT8_MAX) {
+        size = UINT8_MAX;
+    }
+
+    queue_size       = size;
+    queue_head       = 0;
+    queue_count      = 0;
+    debounce_queue   = (debounce_entry_t *)malloc(queue_size * sizeof(debounce_entry_t));
+    debounce_pending = (matrix_row_t *)calloc(num_rows, sizeof(matrix_row_t));
+}
+
+void debounce_free(void) {
+    free(debounce_queue);
+    free(debounce_pending);
+    debounce_queue   = NULL;
+    debounce_pending = NULL;
+}
+
+static bool transfer_expired(matrix_row_t raw[], matrix_row_t cooked[], fast_timer_t now) {
+    bool cooked_changed = false;
+
+    while (queue_count > 0) {
+        debounce_entry_t *entry = &debounce_queue[queue_head];
+        if (TIMER_DIFF_FAST(now, entry->start) < DEBOUNCE) {
+            break;
+        }
+
+        matrix_row_t mask = entry->mask & debounce_pending[entry->row];
+        if (mask) {
+            matrix_row_t cooked_next = (cooked[entry->row] & ~mask) | (raw[entry->row] & mask);
+            cooked_changed |= cooked[entry->row] ^ cooked_next;
+            cooked[entry->row] = cooked_next;
+            debounce_pending[entry->row] &= ~mask;
+        }
+
+        queue_head = (queue_head + 1) % queue_size;
+        queue_count--;
+    }
+
+    return cooked_changed;
+}
+
+static void cancel_pending(uint8_t row, matrix_row_t mask) {
+    for (uint8_t i = 0; i < queue_count; i++) {
+        debounce_entry_t *entry = &debounce_queue[QUEUE_INDEX(i)];
+        if (entry->row == row) {
+            entry->mask &= ~mask;
+        }
+    }
+}
+
+static void collapse_queue(uint8_t num_rows, fast_timer_t now) {
+    queue_head  = 0;
+    queue_count = 0;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        if (debounce_pending[row]) {
+            debounce_queue[queue_count++] = (debounce_entry_t){.start = now, .row = row, .mask = debounce_pending[row]};
+        }
+    }
+}
+
+static void start_pending(uint8_t row, matrix_row_t mask, uint8_t num_rows, fast_timer_t now) {
+    if (queue_count > 0) {
+        // keys of the same row starting in the same scan share an entry
+        debounce_entry_t *tail = &debounce_queue[QUEUE_INDEX(queue_count - 1)];
+        if (tail->row == row && tail->start == now) {
+            tail->mask |= mask;
+            debounce_pending[row] |= mask;
+            return;
+        }
+    }
+
+    debounce_pending[row] |= mask;
+    if (queue_count == queue_size) {
+        // already includes the new keys, as debounce_pending was updated first
+        collapse_queue(num_rows, now);
+        return;
+    }
+
+    debounce_queue[QUEUE_INDEX(queue_count)] = (debounce_entry_t){.start = now, .row = row, .mask = mask};
+    queue_count++;
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    if (!changed && queue_count == 0) {
+        return false;
+    }
+
+    fast_timer_t now            = timer_read_fast();
+    bool         cooked_changed = transfer_expired(raw, cooked, now);
+
+    if (changed) {
+        for (uint8_t row = 0; row < num_rows; row++) {
+            matrix_row_t delta     = raw[row] ^ cooked[row];
+            matrix_row_t cancelled = debounce_pending[row] & ~delta;
+            matrix_row_t started   = delta & ~debounce_pending[row];
+
+            if (cancelled) {
+                debounce_pending[row] &= ~cancelled;
+                cancel_pending(row, cancelled);
+            }
+            if (started) {
+                start_pending(row, started, num_rows, now);
+            }
+        }
+    }
+
+    return cooked_changed;
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,101 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Measures the host time spent in debounce() per scan, for a large matrix and a few
+ * typical input patterns. Each scan advances the timer by 1ms. */
+class DebounceBenchmark : public ::testing::Test {
+   protected:
+    static constexpr int SCANS = 200000;
+
+    void SetUp() override {
+        std::fill(std::begin(raw_), std::end(raw_), 0);
+        std::fill(std::begin(cooked_), std::end(cooked_), 0);
+        debounce_init(MATRIX_ROWS);
+        set_time(1000);
+    }
+
+    void TearDown() override {
+        debounce_free();
+    }
+
+    void toggle(uint8_t row, uint8_t col) {
+        raw_[row] ^= (matrix_row_t)1 << col;
+    }
+
+    void scan(bool changed) {
+        auto start = std::chrono::steady_clock::now();
+        debounce(raw_, cooked_, MATRIX_ROWS, changed);
+        auto end = std::chrono::steady_clock::now();
+        samples_.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        advance_time(1);
+    }
+
+    void report(const char *pattern) {
+        std::sort(samples_.begin(), samples_.end());
+        uint64_t sum = 0;
+        for (auto sample : samples_) {
+            sum += sample;
+        }
+        std::cout << "[ DEBOUNCE ] " << MATRIX_ROWS << "x" << MATRIX_COLS << " " << std::left << std::setw(16) << pattern << std::right << " mean " << std::setw(6) << sum / samples_.size() << "ns  p50 " << std::setw(6) << samples_[samples_.size() / 2] << "ns  p99 " << std::setw(6) << samples_[samples_.size() * 99 / 100] << "ns" << std::endl;
+        samples_.clear();
+    }
+
+    matrix_row_t          raw_[MATRIX_ROWS];
+    matrix_row_t          cooked_[MATRIX_ROWS];
+    std::vector<uint64_t> samples_;
+};
+
+TEST_F(DebounceBenchmark, Idle) {
+    for (int i = 0; i < SCANS; i++) {
+        scan(false);
+    }
+    report("idle");
+}
+
+TEST_F(DebounceBenchmark, Typing) {
+    /* A new key every 25ms, bouncing twice on press and release. */
+    uint32_t seed = 0x1357;
+    for (int i = 0; i < SCANS / 50; i++) {
+        seed        = seed * 1103515245 + 12345;
+        uint8_t row = (seed >> 16) % MATRIX_ROWS;
+        uint8_t col = (seed >> 8) % MATRIX_COLS;
+
+        for (int edge = 0; edge < 2; edge++) {
+            toggle(row, col);
+            scan(true);
+            toggle(row, col);
+            scan(true);
+            toggle(row, col);
+            scan(true);
+            for (int j = 0; j < 22; j++) {
+                scan(false);
+            }
+        }
+    }
+    report("typing");
+}
+
+TEST_F(DebounceBenchmark, ContinuousBounce) {
+    /* Eight keys chattering continuously, one of them changing every scan. */
+    for (int i = 0; i < SCANS; i++) {
+        toggle((i % 8) * MATRIX_ROWS / 8, (i * 5) % MATRIX_COLS);
+        scan(true);
+    }
+    report("chatter");
+}
@@ -33,6 +33,11 @@ debounce_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
 
+debounce_sym_defer_pk_bitmask_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_bitmask_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_bitmask.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_bitmask_tests.cpp
+
 debounce_sym_defer_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pr.c \
@@ -52,3 +57,15 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+DEBOUNCE_BENCHMARK_DEFS := -DMATRIX_ROWS=16 -DMATRIX_COLS=24 -DDEBOUNCE=5
+
+debounce_benchmark_sym_defer_pk_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_benchmark_sym_defer_pk_SRC := $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_benchmark_sym_defer_pk_bitmask_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_benchmark_sym_defer_pk_bitmask_SRC := $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_bitmask.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
@@ -21,6 +21,7 @@
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "action_layer.h"
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,6 +102,117 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+#    include <string.h>
+#    include "timer.h"
+#    include "util.h"
+
+// How long the keymap has to be left alone before changes are written back to EEPROM
+#    ifndef DYNAMIC_KEYMAP_WRITE_DELAY
+#        define DYNAMIC_KEYMAP_WRITE_DELAY 1000
+#    endif
+
+// Changes are written back this many bytes at a time, one chunk per dynamic_keymap_task()
+#    ifndef DYNAMIC_KEYMAP_WRITE_CHUNK_SIZE
+#        define DYNAMIC_KEYMAP_WRITE_CHUNK_SIZE 32
+#    endif
+
+#    define DYNAMIC_KEYMAP_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#    ifdef ENCODER_MAP_ENABLE
+#        define DYNAMIC_KEYMAP_ENCODER_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+#    else
+#        define DYNAMIC_KEYMAP_ENCODER_SIZE 0
+#    endif
+#    define DYNAMIC_KEYMAP_MIRROR_SIZE (DYNAMIC_KEYMAP_KEYMAP_SIZE + DYNAMIC_KEYMAP_ENCODER_SIZE)
+#    define DYNAMIC_KEYMAP_MIRROR_CHUNKS ((DYNAMIC_KEYMAP_MIRROR_SIZE + DYNAMIC_KEYMAP_WRITE_CHUNK_SIZE - 1) / DYNAMIC_KEYMAP_WRITE_CHUNK_SIZE)
+
+// Copy of the keymap, followed by the encoder map, in the same layout as EEPROM.
+// Loaded by dynamic_keymap_init(), unless a reset already filled it in.
+static uint8_t  dynamic_keymap_mirror[DYNAMIC_KEYMAP_MIRROR_SIZE];
+static uint8_t  dynamic_keymap_dirty_chunks[(DYNAMIC_KEYMAP_MIRROR_CHUNKS + 7) / 8];
+static bool     dynamic_keymap_mirror_loaded = false;
+static bool     dynamic_keymap_mirror_dirty  = false;
+static uint16_t dynamic_keymap_last_write    = 0;
+
+static void *dynamic_keymap_mirror_to_eeprom_address(uint16_t offset) {
+    if (offset < DYNAMIC_KEYMAP_KEYMAP_SIZE) {
+        return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset;
+    }
+    return ((void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (offset - DYNAMIC_KEYMAP_KEYMAP_SIZE);
+}
+
+static void dynamic_keymap_mirror_load(void) {
+    eeprom_read_block(dynamic_keymap_mirror, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_KEYMAP_SIZE);
+#    ifdef ENCODER_MAP_ENABLE
+    eeprom_read_block(dynamic_keymap_mirror + DYNAMIC_KEYMAP_KEYMAP_SIZE, (void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, DYNAMIC_KEYMAP_ENCODER_SIZE);
+#    endif
+    memset(dynamic_keymap_dirty_chunks, 0, sizeof(dynamic_keymap_dirty_chunks));
+    dynamic_keymap_mirror_dirty  = false;
+    dynamic_keymap_mirror_loaded = true;
+}
+
+static uint8_t *dynamic_keymap_mirror_get(uint16_t offset) {
+    return &dynamic_keymap_mirror[offset];
+}
+
+static void dynamic_keymap_mirror_write(uint16_t offset, uint8_t value) {
+    uint8_t *p = dynamic_keymap_mirror_get(offset);
+    if (*p != value) {
+        uint16_t chunk = offset / DYNAMIC_KEYMAP_WRITE_CHUNK_SIZE;
+        dynamic_keymap_dirty_chunks[chunk / 8] |= 1 << (chunk % 8);
+        *p                          = value;
+        dynamic_keymap_mirror_dirty = true;
+        dynamic_keymap_last_write   = timer_read();
+    }
+}
+
+static void dynamic_keymap_flush_chunk(uint16_t chunk) {
+    uint16_t start = chunk * DYNAMIC_KEYMAP_WRITE_CHUNK_SIZE;
+    uint16_t end   = MIN(start + DYNAMIC_KEYMAP_WRITE_CHUNK_SIZE, DYNAMIC_KEYMAP_MIRROR_SIZE);
+    // The keymap and encoder map are not necessarily adjacent in EEPROM
+    if (start < DYNAMIC_KEYMAP_KEYMAP_SIZE && end > DYNAMIC_KEYMAP_KEYMAP_SIZE) {
+        eeprom_update_block(&dynamic_keymap_mirror[start], dynamic_keymap_mirror_to_eeprom_address(start), DYNAMIC_KEYMAP_KEYMAP_SIZE - start);
+        start = DYNAMIC_KEYMAP_KEYMAP_SIZE;
+    }
+    eeprom_update_block(&dynamic_keymap_mirror[start], dynamic_keymap_mirror_to_eeprom_address(start), end - start);
+    dynamic_keymap_dirty_chunks[chunk / 8] &= ~(1 << (chunk % 8));
+}
+
+void dynamic_keymap_flush(void) {
+    if (!dynamic_keymap_mirror_dirty) return;
+    for (uint16_t chunk = 0; chunk < DYNAMIC_KEYMAP_MIRROR_CHUNKS; chunk++) {
+        if (dynamic_keymap_dirty_chunks[chunk / 8] & (1 << (chunk % 8))) {
+            dynamic_keymap_flush_chunk(chunk);
+        }
+    }
+    dynamic_keymap_mirror_dirty = false;
+}
+
+void dynamic_keymap_task(void) {
+    if (!dynamic_keymap_mirror_dirty || timer_elapsed(dynamic_keymap_last_write) < DYNAMIC_KEYMAP_WRITE_DELAY) return;
+    for (uint16_t chunk = 0; chunk < DYNAMIC_KEYMAP_MIRROR_CHUNKS; chunk++) {
+        if (dynamic_keymap_dirty_chunks[chunk / 8] & (1 << (chunk % 8))) {
+            dynamic_keymap_flush_chunk(chunk);
+            return;
+        }
+    }
+    dynamic_keymap_mirror_dirty = false;
+}
+
+void dynamic_keymap_init(void) {
+    if (!dynamic_keymap_mirror_loaded) {
+        dynamic_keymap_mirror_load();
+    }
+}
+
+void dynamic_keymap_mirror_invalidate(void) {
+    // Before init there is nothing to reload, dynamic_keymap_init() loads the current contents
+    if (dynamic_keymap_mirror_loaded) {
+        dynamic_keymap_mirror_load();
+    }
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,19 +224,33 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    uint8_t *p = dynamic_keymap_mirror_get((layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2));
+    return (p[0] << 8) | p[1];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    uint16_t offset = (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    dynamic_keymap_mirror_write(offset, (uint8_t)(keycode >> 8));
+    dynamic_keymap_mirror_write(offset + 1, (uint8_t)(keycode & 0xFF));
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+    layer_lookup_cache_clear();
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -134,19 +260,30 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    uint8_t *p = dynamic_keymap_mirror_get(DYNAMIC_KEYMAP_KEYMAP_SIZE + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2) + (clockwise ? 0 : 2));
+    return ((uint16_t)p[0] << 8) | p[1];
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    uint16_t offset = DYNAMIC_KEYMAP_KEYMAP_SIZE + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2) + (clockwise ? 0 : 2);
+    dynamic_keymap_mirror_write(offset, (uint8_t)(keycode >> 8));
+    dynamic_keymap_mirror_write(offset + 1, (uint8_t)(keycode & 0xFF));
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -165,15 +302,28 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    // Every byte of the mirror was just set, so it is valid even if it had not been loaded yet,
+    // but it may differ from EEPROM anywhere. Resets are rare, and callers expect the keymap to
+    // be in EEPROM when this returns.
+    memset(dynamic_keymap_dirty_chunks, 0xFF, sizeof(dynamic_keymap_dirty_chunks));
+    dynamic_keymap_mirror_dirty  = true;
+    dynamic_keymap_mirror_loaded = true;
+    dynamic_keymap_flush();
+#endif
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   source                     = ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset;
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+            *target = *dynamic_keymap_mirror_get(offset + i);
+#else
             *target = eeprom_read_byte(source);
+#endif
         } else {
             *target = 0x00;
         }
@@ -184,15 +334,22 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   target                     = ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset;
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+            dynamic_keymap_mirror_write(offset + i, *source);
+#else
             eeprom_update_byte(target, *source);
+#endif
         }
         source++;
         target++;
     }
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+    layer_lookup_cache_clear();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,7 +377,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +391,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
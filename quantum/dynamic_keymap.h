@@ -27,6 +27,16 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
 void     dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode);
 #endif // ENCODER_MAP_ENABLE
 void dynamic_keymap_reset(void);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// Loads the RAM copy of the keymap from EEPROM, unless a reset already filled it in
+void dynamic_keymap_init(void);
+// Writes any keymap changes still held in RAM back to EEPROM
+void dynamic_keymap_flush(void);
+// Writes back part of the pending changes, once the keymap has been left alone for a while
+void dynamic_keymap_task(void);
+// Reloads the RAM copy of the keymap from EEPROM, after EEPROM was changed behind its back
+void dynamic_keymap_mirror_invalidate(void);
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 // These get/set the keycodes as stored in the EEPROM buffer
 // Data is big-endian 16-bit values (the keycodes)
 // Order is by layer/row/column
@@ -0,0 +1,79 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "effect_scheduler.h"
+#include "print.h"
+
+// Weight of a new sample in the running averages, as 1 / (1 << EFFECT_SCHEDULER_AVERAGE_SHIFT)
+#ifndef EFFECT_SCHEDULER_AVERAGE_SHIFT
+#    define EFFECT_SCHEDULER_AVERAGE_SHIFT 3
+#endif
+
+#define EFFECT_SCHEDULER_FPS_PERIOD 1000
+
+static uint32_t average(uint32_t avg, uint32_t sample) {
+    return (uint32_t)((int32_t)avg + (((int32_t)sample - (int32_t)avg) >> EFFECT_SCHEDULER_AVERAGE_SHIFT));
+}
+
+static uint16_t saturate16(uint32_t value) {
+    return value > UINT16_MAX ? UINT16_MAX : value;
+}
+
+void effect_scheduler_init(effect_scheduler_t *scheduler, uint16_t budget_us, uint8_t led_count, uint8_t process_limit) {
+    if (process_limit == 0 || process_limit > led_count) process_limit = led_count;
+    if (process_limit == 0) process_limit = 1;
+
+    *scheduler = (effect_scheduler_t){
+        .budget_us     = budget_us,
+        .led_count     = led_count,
+        .process_limit = process_limit,
+        // start out assuming the configured process limit exactly fills the budget
+        .led_cost     = ((uint32_t)budget_us << 4) / process_limit,
+        .frames_since = timer_read32(),
+    };
+}
+
+uint8_t effect_scheduler_frame_start(effect_scheduler_t *scheduler) {
+    uint32_t limit = scheduler->led_count;
+    if (scheduler->led_cost > 0) {
+        limit = ((uint32_t)scheduler->budget_us << 4) / scheduler->led_cost;
+    }
+    if (limit > scheduler->led_count) limit = scheduler->led_count;
+    if (limit < 1) limit = 1;
+
+    scheduler->process_limit = limit;
+    return scheduler->process_limit;
+}
+
+void effect_scheduler_render_done(effect_scheduler_t *scheduler, uint8_t led_min, uint8_t led_max, uint32_t elapsed_us) {
+    uint16_t slice_us = saturate16(elapsed_us);
+
+    scheduler->slice_us = average(scheduler->slice_us, slice_us);
+    if (slice_us > scheduler->slice_max_us) scheduler->slice_max_us = slice_us;
+
+    // slices without LEDs, such as the other half of a split keyboard, say nothing about the cost per LED
+    if (led_max > led_min) {
+        scheduler->led_cost = average(scheduler->led_cost, (elapsed_us << 4) / (led_max - led_min));
+    }
+}
+
+void effect_scheduler_flush_done(effect_scheduler_t *scheduler, uint32_t elapsed_us) {
+    uint16_t flush_us = saturate16(elapsed_us);
+
+    scheduler->flush_us = average(scheduler->flush_us, flush_us);
+    if (flush_us > scheduler->flush_max_us) scheduler->flush_max_us = flush_us;
+
+    scheduler->frames++;
+    uint32_t elapsed = timer_elapsed32(scheduler->frames_since);
+    if (elapsed >= EFFECT_SCHEDULER_FPS_PERIOD) {
+        scheduler->fps          = ((uint32_t)scheduler->frames * 1000) / elapsed;
+        scheduler->frames       = 0;
+        scheduler->frames_since = timer_read32();
+    }
+}
+
+void effect_scheduler_print(effect_scheduler_t *scheduler, const char *name) {
+    uprintf("%s: %u fps, %u leds/slice, slice %uus (max %uus), flush %uus (max %uus)\n", name, scheduler->fps, scheduler->process_limit, scheduler->slice_us, scheduler->slice_max_us, scheduler->flush_us, scheduler->flush_max_us);
+    scheduler->slice_max_us = 0;
+    scheduler->flush_max_us = 0;
+}
@@ -0,0 +1,76 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "timer.h"
+
+/*
+ * Adaptive frame scheduler for the RGB Matrix and LED Matrix tasks.
+ *
+ * The matrix tasks render a frame over several calls, a number of LEDs at a time, so that the
+ * keyboard keeps scanning while the effect is drawn. The scheduler measures how long each render
+ * slice takes, and picks the number of LEDs for the next frame so that a slice stays within the
+ * given time budget. The fewer slices a frame needs, the higher the achieved frame rate.
+ */
+
+// Slices take a few hundred microseconds, so they have to be timed with microsecond resolution.
+// Platforms without such a timer leave effect_scheduler_timestamp() undefined, and the matrix
+// tasks keep their static process limit.
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include "chibios_config.h"
+#    if PORT_SUPPORTS_RT == TRUE
+// The realtime counter: the cycle counter on most ARM cores, a 1MHz timer on RP2040
+typedef rtcnt_t effect_scheduler_timestamp_t;
+#        define effect_scheduler_timestamp() chSysGetRealtimeCounterX()
+#        define effect_scheduler_elapsed_us(start) ((uint32_t)((rtcnt_t)(chSysGetRealtimeCounterX() - (start)) / (REALTIME_COUNTER_CLOCK / 1000000)))
+#    elif CH_CFG_ST_FREQUENCY >= 100000
+typedef systime_t effect_scheduler_timestamp_t;
+#        define effect_scheduler_timestamp() chVTGetSystemTimeX()
+#        define effect_scheduler_elapsed_us(start) ((uint32_t)TIME_I2US(chVTTimeElapsedSinceX(start)))
+#    endif
+#elif defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB) || defined(PROTOCOL_ARM_ATSAM)
+// Only a millisecond timer, which would measure most slices as taking no time at all
+#else
+// Unit tests, where time only moves when the test advances it
+typedef uint32_t effect_scheduler_timestamp_t;
+#    define effect_scheduler_timestamp() timer_read32()
+#    define effect_scheduler_elapsed_us(start) (timer_elapsed32(start) * 1000)
+#endif
+
+typedef struct {
+    uint16_t budget_us;     // time allowed for a single render slice
+    uint8_t  led_count;     // upper bound of the process limit
+    uint8_t  process_limit; // LEDs rendered per slice, only changes between frames
+    uint32_t led_cost;      // average render time per LED, in 1/16 us
+    uint16_t slice_us;      // average render slice time
+    uint16_t slice_max_us;  // longest render slice since the last print
+    uint16_t flush_us;      // average flush time
+    uint16_t flush_max_us;  // longest flush since the last print
+    uint16_t fps;           // frames flushed over the last second
+    uint16_t frames;        // frames flushed in the current second
+    uint32_t frames_since;
+} effect_scheduler_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void effect_scheduler_init(effect_scheduler_t *scheduler, uint16_t budget_us, uint8_t led_count, uint8_t process_limit);
+
+/* picks the number of LEDs to render per slice for the next frame, and returns it */
+uint8_t effect_scheduler_frame_start(effect_scheduler_t *scheduler);
+
+/* records a render slice covering LEDs led_min to led_max, and a flush to the driver */
+void effect_scheduler_render_done(effect_scheduler_t *scheduler, uint8_t led_min, uint8_t led_max, uint32_t elapsed_us);
+void effect_scheduler_flush_done(effect_scheduler_t *scheduler, uint32_t elapsed_us);
+
+/* prints the frame rate and slice timings to the console, and resets the maximums */
+void effect_scheduler_print(effect_scheduler_t *scheduler, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
@@ -102,6 +102,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -366,6 +369,9 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
     housekeeping_task_kb();
     housekeeping_task_user();
 }
@@ -412,6 +418,10 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    // after via_init() and quantum_init(), which may reset the keymap or EEPROM
+    dynamic_keymap_init();
+#endif
 #if defined(CRC_ENABLE)
     crc_init();
 #endif
@@ -433,6 +443,9 @@ void keyboard_init(void) {
 #ifdef STENO_ENABLE_ALL
     steno_init();
 #endif
+#ifdef COMBO_ENABLE
+    combo_init();
+#endif
 #if defined(NKRO_ENABLE) && defined(FORCE_NKRO)
     keymap_config.nkro = 1;
     eeconfig_update_keymap(keymap_config.raw);
@@ -717,5 +730,9 @@ void keyboard_task(void) {
     haptic_task();
 #endif
 
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_task();
+#endif
+
     led_task();
 }
@@ -76,8 +76,10 @@ __attribute__((weak)) uint16_t keycode_at_encodermap_location(uint8_t layer_num,
 
 #if defined(COMBO_ENABLE)
 
+#    define NUM_COMBOS_RAW ((uint16_t)(sizeof(key_combos) / sizeof(combo_t)))
+
 uint16_t combo_count_raw(void) {
-    return sizeof(key_combos) / sizeof(combo_t);
+    return NUM_COMBOS_RAW;
 }
 __attribute__((weak)) uint16_t combo_count(void) {
     return combo_count_raw();
@@ -90,4 +92,24 @@ __attribute__((weak)) combo_t* combo_get(uint16_t combo_idx) {
     return combo_get_raw(combo_idx);
 }
 
+#    ifdef COMBO_KEYCODE_INDEX
+
+#        ifndef COMBO_KEYCODE_INDEX_SIZE
+#            define COMBO_KEYCODE_INDEX_SIZE NUM_COMBOS_RAW
+#        endif // COMBO_KEYCODE_INDEX_SIZE
+
+_Static_assert(COMBO_KEYCODE_INDEX_SIZE >= NUM_COMBOS_RAW, "Number of combos exceeds the size of the combo keycode index set by COMBO_KEYCODE_INDEX_SIZE");
+
+static uint32_t combo_keycode_index[COMBO_KEYCODE_INDEX_BUCKETS][(COMBO_KEYCODE_INDEX_SIZE + 31) / 32];
+
+uint16_t combo_keycode_index_size_raw(void) {
+    return COMBO_KEYCODE_INDEX_SIZE;
+}
+
+uint32_t* combo_keycode_index_bucket_raw(uint8_t bucket) {
+    return combo_keycode_index[bucket];
+}
+
+#    endif // COMBO_KEYCODE_INDEX
+
 #endif // defined(COMBO_ENABLE)
@@ -54,4 +54,11 @@ combo_t* combo_get_raw(uint16_t combo_idx);
 // Get the keycode for the encoder mapping location, potentially stored dynamically
 combo_t* combo_get(uint16_t combo_idx);
 
+#    ifdef COMBO_KEYCODE_INDEX
+// Get the number of combos the combo keycode index has room for, sized at compile time from the user's keymap
+uint16_t combo_keycode_index_size_raw(void);
+// Get the bitmap of combo indices for a keycode bucket of the combo keycode index
+uint32_t* combo_keycode_index_bucket_raw(uint8_t bucket);
+#    endif // COMBO_KEYCODE_INDEX
+
 #endif // defined(COMBO_ENABLE)
@@ -77,6 +77,9 @@ static led_task_states led_task_state    = SYNCING;
 #if LED_MATRIX_TIMEOUT > 0
 static uint32_t led_anykey_timer;
 #endif // LED_MATRIX_TIMEOUT > 0
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+static effect_scheduler_t led_scheduler;
+#endif // LED_MATRIX_SCHEDULER_BUDGET_US
 
 // double buffers
 static uint32_t led_timer_buffer;
@@ -247,6 +250,11 @@ static void led_task_start(void) {
     // reset iter
     led_effect_params.iter = 0;
 
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+    // the limits have to stay the same for all iterations of a frame
+    effect_scheduler_frame_start(&led_scheduler);
+#endif // LED_MATRIX_SCHEDULER_BUDGET_US
+
     // update double buffers
     g_led_timer = led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
@@ -322,6 +330,22 @@ static void led_task_flush(uint8_t effect) {
     led_task_state = SYNCING;
 }
 
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+static void led_task_stats(void) {
+#    if LED_MATRIX_SCHEDULER_STATS_INTERVAL > 0
+    static uint32_t last_print = 0;
+    if (debug_enable && timer_elapsed32(last_print) >= LED_MATRIX_SCHEDULER_STATS_INTERVAL) {
+        last_print = timer_read32();
+        effect_scheduler_print(&led_scheduler, "led matrix");
+    }
+#    endif // LED_MATRIX_SCHEDULER_STATS_INTERVAL > 0
+}
+
+effect_scheduler_t *led_matrix_get_scheduler(void) {
+    return &led_scheduler;
+}
+#endif // LED_MATRIX_SCHEDULER_BUDGET_US
+
 void led_matrix_task(void) {
     led_task_timers();
 
@@ -339,7 +363,11 @@ void led_matrix_task(void) {
         case STARTING:
             led_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+            struct led_matrix_limits_t   limits = led_matrix_get_limits(led_effect_params.iter);
+            effect_scheduler_timestamp_t start  = effect_scheduler_timestamp();
+#endif // LED_MATRIX_SCHEDULER_BUDGET_US
             led_task_render(effect);
             if (effect) {
                 if (led_task_state == FLUSHING) {
@@ -347,10 +375,20 @@ void led_matrix_task(void) {
                 }
                 led_matrix_indicators_advanced(&led_effect_params);
             }
-            break;
-        case FLUSHING:
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+            effect_scheduler_render_done(&led_scheduler, limits.led_min_index, limits.led_max_index, effect_scheduler_elapsed_us(start));
+#endif // LED_MATRIX_SCHEDULER_BUDGET_US
+        } break;
+        case FLUSHING: {
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+            effect_scheduler_timestamp_t start = effect_scheduler_timestamp();
+#endif // LED_MATRIX_SCHEDULER_BUDGET_US
             led_task_flush(effect);
-            break;
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+            effect_scheduler_flush_done(&led_scheduler, effect_scheduler_elapsed_us(start));
+            led_task_stats();
+#endif // LED_MATRIX_SCHEDULER_BUDGET_US
+        } break;
         case SYNCING:
             led_task_sync();
             break;
@@ -389,17 +427,22 @@ __attribute__((weak)) bool led_matrix_indicators_advanced_user(uint8_t led_min,
 
 struct led_matrix_limits_t led_matrix_get_limits(uint8_t iter) {
     struct led_matrix_limits_t limits = {0};
-#if defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < LED_MATRIX_LED_COUNT
+#if defined(LED_MATRIX_SCHEDULER_BUDGET_US) || (defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < LED_MATRIX_LED_COUNT)
+#    ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+    uint8_t process_limit = led_scheduler.process_limit;
+#    else
+    uint8_t process_limit = LED_MATRIX_LED_PROCESS_LIMIT;
+#    endif
 #    if defined(LED_MATRIX_SPLIT)
-    limits.led_min_index = LED_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + LED_MATRIX_LED_PROCESS_LIMIT;
+    limits.led_min_index = process_limit * (iter);
+    limits.led_max_index = limits.led_min_index + process_limit;
     if (limits.led_max_index > LED_MATRIX_LED_COUNT) limits.led_max_index = LED_MATRIX_LED_COUNT;
     uint8_t k_led_matrix_split[2] = LED_MATRIX_SPLIT;
     if (is_keyboard_left() && (limits.led_max_index > k_led_matrix_split[0])) limits.led_max_index = k_led_matrix_split[0];
     if (!(is_keyboard_left()) && (limits.led_min_index < k_led_matrix_split[0])) limits.led_min_index = k_led_matrix_split[0];
 #    else
-    limits.led_min_index = LED_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + LED_MATRIX_LED_PROCESS_LIMIT;
+    limits.led_min_index = process_limit * (iter);
+    limits.led_max_index = limits.led_min_index + process_limit;
     if (limits.led_max_index > LED_MATRIX_LED_COUNT) limits.led_max_index = LED_MATRIX_LED_COUNT;
 #    endif
 #else
@@ -420,6 +463,10 @@ struct led_matrix_limits_t led_matrix_get_limits(uint8_t iter) {
 void led_matrix_init(void) {
     led_matrix_driver.init();
 
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+    effect_scheduler_init(&led_scheduler, LED_MATRIX_SCHEDULER_BUDGET_US, LED_MATRIX_LED_COUNT, LED_MATRIX_LED_PROCESS_LIMIT);
+#endif // LED_MATRIX_SCHEDULER_BUDGET_US
+
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -89,6 +89,31 @@
 #    define LED_MATRIX_LED_PROCESS_LIMIT ((LED_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+// Specializing the effect runners trades flash for speed, so it is left off on AVR by default
+#ifndef LED_MATRIX_EFFECT_SPECIALIZATION
+#    ifdef __AVR__
+#        define LED_MATRIX_EFFECT_SPECIALIZATION 0
+#    else
+#        define LED_MATRIX_EFFECT_SPECIALIZATION 1
+#    endif
+#endif
+
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+#    include "effect_scheduler.h"
+#    ifndef effect_scheduler_timestamp
+#        pragma message "LED_MATRIX_SCHEDULER_BUDGET_US needs a microsecond timer, which this platform lacks. Using LED_MATRIX_LED_PROCESS_LIMIT instead."
+#        undef LED_MATRIX_SCHEDULER_BUDGET_US
+#    endif
+#endif
+
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+
+// Interval at which the frame rate and slice timings are printed to the console while debug is enabled, 0 to disable
+#    ifndef LED_MATRIX_SCHEDULER_STATS_INTERVAL
+#        define LED_MATRIX_SCHEDULER_STATS_INTERVAL 10000
+#    endif
+#endif
+
 struct led_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -158,6 +183,9 @@ bool led_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool led_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void led_matrix_init(void);
+#ifdef LED_MATRIX_SCHEDULER_BUDGET_US
+effect_scheduler_t *led_matrix_get_scheduler(void);
+#endif
 
 void        led_matrix_set_suspend_state(bool state);
 bool        led_matrix_get_suspend_state(void);
@@ -22,6 +22,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "debounce.h"
 #include "atomic_util.h"
 
+#ifdef MATRIX_SCAN_MODE_INTERRUPT
+#    include "matrix_interrupt.h"
+#    include "timer.h"
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -135,6 +140,96 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
 
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+#        ifdef MATRIX_PORT_READS
+#            ifndef readPinPort
+#                error MATRIX_PORT_READS requires readPinPort(), getPinPort() and getPinPad() from the platform
+#            endif
+#            if (DIODE_DIRECTION == COL2ROW)
+#                define MATRIX_PORT_INPUTS MATRIX_COLS
+#                define matrix_port_input_pins col_pins
+typedef matrix_row_t matrix_port_bits_t;
+#            elif (ROWS_PER_HAND <= 8)
+#                define MATRIX_PORT_INPUTS ROWS_PER_HAND
+#                define matrix_port_input_pins row_pins
+typedef uint8_t matrix_port_bits_t;
+#            elif (ROWS_PER_HAND <= 16)
+#                define MATRIX_PORT_INPUTS ROWS_PER_HAND
+#                define matrix_port_input_pins row_pins
+typedef uint16_t matrix_port_bits_t;
+#            else
+#                define MATRIX_PORT_INPUTS ROWS_PER_HAND
+#                define matrix_port_input_pins row_pins
+typedef uint32_t matrix_port_bits_t;
+#            endif
+
+// Consecutive inputs wired to consecutive pads of a port, extracted with a single shift and mask.
+// Built by matrix_init() from the pin arrays: the preprocessor cannot split MATRIX_COL_PINS into
+// pins, and split keyboards may swap in the right hand pins at runtime.
+typedef struct {
+    uint8_t     port;  // index into matrix_ports
+    uint8_t     pad;   // pad of the first input
+    uint8_t     input; // index of the first input
+    port_mask_t mask;  // one bit per input, starting at bit 0
+} matrix_port_run_t;
+
+static pin_t             matrix_ports[MATRIX_PORT_INPUTS];
+static uint8_t           matrix_port_count;
+static matrix_port_run_t matrix_port_runs[MATRIX_PORT_INPUTS];
+static uint8_t           matrix_port_run_count;
+
+static void matrix_init_port_reads(void) {
+    uint8_t run_length = 0;
+
+    matrix_port_count     = 0;
+    matrix_port_run_count = 0;
+    for (uint8_t input = 0; input < MATRIX_PORT_INPUTS; input++) {
+        pin_t pin = matrix_port_input_pins[input];
+        if (pin == NO_PIN) {
+            continue;
+        }
+
+        uint8_t port = 0;
+        while (port < matrix_port_count && matrix_ports[port] != getPinPort(pin)) {
+            port++;
+        }
+        if (port == matrix_port_count) {
+            matrix_ports[matrix_port_count++] = getPinPort(pin);
+        }
+
+        matrix_port_run_t *run = matrix_port_run_count > 0 ? &matrix_port_runs[matrix_port_run_count - 1] : NULL;
+        if (run && run->port == port && run->pad + run_length == getPinPad(pin) && run->input + run_length == input) {
+            run_length++;
+        } else {
+            run        = &matrix_port_runs[matrix_port_run_count++];
+            run->port  = port;
+            run->pad   = getPinPad(pin);
+            run->input = input;
+            run_length = 1;
+        }
+        run->mask = (port_mask_t)(~(port_mask_t)0) >> (sizeof(port_mask_t) * 8 - run_length);
+    }
+}
+
+// Read each port once, returning one bit per input that is in the pressed state
+static inline matrix_port_bits_t matrix_read_ports(void) {
+    port_mask_t        port_state[MATRIX_PORT_INPUTS];
+    matrix_port_bits_t inputs = 0;
+
+    for (uint8_t port = 0; port < matrix_port_count; port++) {
+#            if MATRIX_INPUT_PRESSED_STATE == 0
+        port_state[port] = ~readPinPort(matrix_ports[port]);
+#            else
+        port_state[port] = readPinPort(matrix_ports[port]);
+#            endif
+    }
+    for (uint8_t i = 0; i < matrix_port_run_count; i++) {
+        const matrix_port_run_t *run = &matrix_port_runs[i];
+        inputs |= (matrix_port_bits_t)((port_state[run->port] >> run->pad) & run->mask) << run->input;
+    }
+    return inputs;
+}
+#        endif
+
 #        if (DIODE_DIRECTION == COL2ROW)
 
 static bool select_row(uint8_t row) {
@@ -181,6 +276,9 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_READS
+    current_row_value = matrix_read_ports();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -189,6 +287,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -244,10 +343,18 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_READS
+    matrix_port_bits_t rows_pressed = matrix_read_ports();
+#            endif
+
     // For each row...
     for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
         // Check row pin state
+#            ifdef MATRIX_PORT_READS
+        if (rows_pressed & ((matrix_port_bits_t)1 << row_index)) {
+#            else
         if (readMatrixPin(row_pins[row_index]) == 0) {
+#            endif
             // Pin LO, set col bit
             current_matrix[row_index] |= row_shifter;
             key_pressed = true;
@@ -270,6 +377,116 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_SCAN_MODE_INTERRUPT
+#    if !defined(DIRECT_PINS) && !(defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS))
+#        error MATRIX_SCAN_MODE = interrupt requires DIRECT_PINS or MATRIX_ROW_PINS and MATRIX_COL_PINS
+#    endif
+
+static bool         matrix_idle = false;
+static fast_timer_t matrix_last_activity;
+
+// Drive every output line and listen for edges on the inputs, or restore the pins for scanning
+static void matrix_interrupt_set_pins(bool listen) {
+#    if defined(DIRECT_PINS)
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            pin_t pin = direct_pins[row][col];
+            if (pin != NO_PIN) {
+                listen ? matrix_interrupt_enable_pin(pin) : matrix_interrupt_disable_pin(pin);
+            }
+        }
+    }
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != NO_PIN) {
+            listen ? matrix_interrupt_enable_pin(col_pins[col]) : matrix_interrupt_disable_pin(col_pins[col]);
+        }
+    }
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        listen ? (void)select_row(row) : unselect_row(row);
+    }
+#    elif (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (row_pins[row] != NO_PIN) {
+            listen ? matrix_interrupt_enable_pin(row_pins[row]) : matrix_interrupt_disable_pin(row_pins[row]);
+        }
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        listen ? (void)select_col(col) : unselect_col(col);
+    }
+#    endif
+}
+
+// With all output lines driven, any pressed key shows up on its input
+static bool matrix_interrupt_input_active(void) {
+#    if defined(DIRECT_PINS)
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (!readMatrixPin(direct_pins[row][col])) {
+                return true;
+            }
+        }
+    }
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (!readMatrixPin(col_pins[col])) {
+            return true;
+        }
+    }
+#    elif (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (!readMatrixPin(row_pins[row])) {
+            return true;
+        }
+    }
+#    endif
+    return false;
+}
+
+static void matrix_sleep(void) {
+    matrix_interrupt_set_pins(true);
+    matrix_output_select_delay();
+
+    // catch any key pressed before the edge events were enabled
+    if (matrix_interrupt_input_active()) {
+        matrix_interrupt_trigger();
+    }
+    matrix_idle = true;
+}
+
+static bool matrix_wake(void) {
+    if (!matrix_interrupt_triggered()) {
+        return false;
+    }
+
+    matrix_interrupt_set_pins(false);
+    matrix_output_unselect_delay(0, true);
+    matrix_idle          = false;
+    matrix_last_activity = timer_read_fast();
+    return true;
+}
+
+static void matrix_idle_task(matrix_row_t cooked[], bool changed) {
+    if (matrix_idle) {
+        return;
+    }
+
+    for (uint8_t row = 0; row < ROWS_PER_HAND && !changed; row++) {
+        changed = raw_matrix[row] | cooked[row];
+    }
+
+    if (changed) {
+        matrix_last_activity = timer_read_fast();
+    } else if (timer_elapsed_fast(matrix_last_activity) >= MATRIX_INTERRUPT_IDLE_TIME) {
+        matrix_sleep();
+    }
+}
+
+bool matrix_interrupt_is_idle(void) {
+    return matrix_idle;
+}
+#endif
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -300,6 +517,10 @@ void matrix_init(void) {
     thatHand = ROWS_PER_HAND - thisHand;
 #endif
 
+#ifdef MATRIX_PORT_READS
+    matrix_init_port_reads();
+#endif
+
     // initialize key pins
     matrix_init_pins();
 
@@ -309,6 +530,11 @@ void matrix_init(void) {
 
     debounce_init(ROWS_PER_HAND);
 
+#ifdef MATRIX_SCAN_MODE_INTERRUPT
+    matrix_idle          = false;
+    matrix_last_activity = timer_read_fast();
+#endif
+
     matrix_init_kb();
 }
 
@@ -320,7 +546,7 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
+static bool matrix_read(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
@@ -338,12 +564,31 @@ uint8_t matrix_scan(void) {
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+    return changed;
+}
+
+uint8_t matrix_scan(void) {
+#ifdef MATRIX_SCAN_MODE_INTERRUPT
+    // While idle, the pins are only read again after an edge
+    bool raw_changed = (!matrix_idle || matrix_wake()) && matrix_read();
+#else
+    bool raw_changed = matrix_read();
+#endif
+    bool changed;
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, raw_changed) | matrix_post_scan();
 #else
-    changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+    changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, raw_changed);
     matrix_scan_kb();
+#endif
+
+#ifdef MATRIX_SCAN_MODE_INTERRUPT
+#    ifdef SPLIT_KEYBOARD
+    matrix_idle_task(matrix + thisHand, raw_changed);
+#    else
+    matrix_idle_task(matrix, raw_changed);
+#    endif
 #endif
     return (uint8_t)changed;
 }
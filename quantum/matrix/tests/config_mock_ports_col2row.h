@@ -0,0 +1,25 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 6
+#define MATRIX_COLS 21
+
+/* Columns spread over five ports: contiguous, reversed and interleaved pads, plus an unused column. */
+#define DIODE_DIRECTION COL2ROW
+#define MATRIX_ROW_PINS \
+    { 0, 1, 2, 3, 5, 4 }
+#define MATRIX_COL_PINS \
+    { 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 33, 32, 40, 42, 44, 26, 25, 24, NO_PIN }
+
+#define DEBOUNCE 0
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock_gpio.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,24 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 6
+
+#define DIODE_DIRECTION ROW2COL
+#define MATRIX_ROW_PINS \
+    { 0, 1, 2, 3 }
+#define MATRIX_COL_PINS \
+    { 8, 9, 10, 11, 12, 13 }
+
+#define DEBOUNCE 5
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock_gpio.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,131 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "debounce.h"
+#include "matrix_interrupt.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+static uint32_t matrix_scan_kb_count = 0;
+
+void matrix_scan_kb(void) {
+    matrix_scan_kb_count++;
+}
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class MatrixInterrupt : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_gpio_reset();
+        matrix_interrupt_triggered();
+        set_time(0);
+        matrix_init();
+        matrix_scan_kb_count = 0;
+    }
+
+    void TearDown() override {
+        debounce_free();
+    }
+
+    void set_key(uint8_t row, uint8_t col, bool pressed) {
+        mock_gpio_set_switch(row_pins[row], col_pins[col], pressed);
+    }
+
+    void scan_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            matrix_scan();
+            advance_time(1);
+        }
+    }
+};
+
+TEST_F(MatrixInterrupt, SleepsWhenIdle) {
+    scan_for(MATRIX_INTERRUPT_IDLE_TIME - 1);
+    EXPECT_FALSE(matrix_interrupt_is_idle());
+
+    scan_for(2);
+    EXPECT_TRUE(matrix_interrupt_is_idle());
+
+    uint32_t reads = mock_gpio_read_count();
+    scan_for(100);
+    EXPECT_TRUE(matrix_interrupt_is_idle());
+    EXPECT_EQ(mock_gpio_read_count(), reads);
+}
+
+TEST_F(MatrixInterrupt, KeepsCallingScanKbWhileIdle) {
+    scan_for(MATRIX_INTERRUPT_IDLE_TIME + 100);
+    EXPECT_TRUE(matrix_interrupt_is_idle());
+    EXPECT_EQ(matrix_scan_kb_count, MATRIX_INTERRUPT_IDLE_TIME + 100);
+}
+
+TEST_F(MatrixInterrupt, PressWakesMatrix) {
+    scan_for(MATRIX_INTERRUPT_IDLE_TIME + 1);
+    ASSERT_TRUE(matrix_interrupt_is_idle());
+
+    set_key(2, 3, true);
+    scan_for(1);
+    EXPECT_FALSE(matrix_interrupt_is_idle());
+
+    scan_for(DEBOUNCE);
+    EXPECT_EQ(matrix_get_row(2), (matrix_row_t)1 << 3);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (row != 2) {
+            EXPECT_EQ(matrix_get_row(row), 0);
+        }
+    }
+}
+
+TEST_F(MatrixInterrupt, HeldKeyKeepsScanning) {
+    set_key(0, 0, true);
+    scan_for(100);
+    EXPECT_FALSE(matrix_interrupt_is_idle());
+    EXPECT_EQ(matrix_get_row(0), 1);
+
+    uint32_t reads = mock_gpio_read_count();
+    scan_for(1);
+    EXPECT_GT(mock_gpio_read_count(), reads);
+}
+
+TEST_F(MatrixInterrupt, ReleaseThenSleepAgain) {
+    scan_for(MATRIX_INTERRUPT_IDLE_TIME + 1);
+    ASSERT_TRUE(matrix_interrupt_is_idle());
+
+    set_key(1, 5, true);
+    scan_for(30);
+    EXPECT_EQ(matrix_get_row(1), (matrix_row_t)1 << 5);
+
+    set_key(1, 5, false);
+    scan_for(DEBOUNCE + 1);
+    EXPECT_EQ(matrix_get_row(1), 0);
+    EXPECT_FALSE(matrix_interrupt_is_idle());
+
+    scan_for(MATRIX_INTERRUPT_IDLE_TIME);
+    EXPECT_TRUE(matrix_interrupt_is_idle());
+
+    set_key(3, 1, true);
+    scan_for(DEBOUNCE + 1);
+    EXPECT_EQ(matrix_get_row(3), (matrix_row_t)1 << 1);
+}
+
+TEST_F(MatrixInterrupt, BounceShorterThanIdleTimeIsDebounced) {
+    scan_for(MATRIX_INTERRUPT_IDLE_TIME + 1);
+    ASSERT_TRUE(matrix_interrupt_is_idle());
+
+    // a glitch wakes the matrix, but never makes it through debouncing
+    set_key(0, 2, true);
+    set_key(0, 2, false);
+    scan_for(1);
+    EXPECT_FALSE(matrix_interrupt_is_idle());
+    scan_for(MATRIX_INTERRUPT_IDLE_TIME + 1);
+    EXPECT_EQ(matrix_get_row(0), 0);
+    EXPECT_TRUE(matrix_interrupt_is_idle());
+}
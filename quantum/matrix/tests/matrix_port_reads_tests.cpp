@@ -0,0 +1,104 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+extern "C" {
+#include "matrix.h"
+#include "debounce.h"
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class MatrixPortReads : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_gpio_reset();
+        matrix_init();
+    }
+
+    void TearDown() override {
+        debounce_free();
+    }
+
+    void set_key(uint8_t row, uint8_t col, bool pressed) {
+        if (col_pins[col] != NO_PIN) {
+            mock_gpio_set_switch(row_pins[row], col_pins[col], pressed);
+        }
+    }
+
+    /* Presses the given keys, returning the expected matrix */
+    void set_keys(const matrix_row_t keys[MATRIX_ROWS], matrix_row_t expected[MATRIX_ROWS]) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            expected[row] = 0;
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                bool pressed = keys[row] & ((matrix_row_t)1 << col);
+                set_key(row, col, pressed);
+                if (pressed && col_pins[col] != NO_PIN) {
+                    expected[row] |= (matrix_row_t)1 << col;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(MatrixPortReads, SingleKeys) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            set_key(row, col, true);
+            matrix_scan();
+            for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+                matrix_row_t expected = (r == row && col_pins[col] != NO_PIN) ? (matrix_row_t)1 << col : 0;
+                EXPECT_EQ(matrix_get_row(r), expected) << "key " << (int)row << "," << (int)col;
+            }
+            set_key(row, col, false);
+        }
+    }
+}
+
+TEST_F(MatrixPortReads, KeysInSameRow) {
+    /* one key in each row, so no ghosting in the simulated matrix */
+    uint32_t seed = 0x2468;
+    for (int i = 0; i < 500; i++) {
+        matrix_row_t keys[MATRIX_ROWS] = {0};
+        matrix_row_t expected[MATRIX_ROWS];
+
+        uint8_t row = i % MATRIX_ROWS;
+        seed        = seed * 1103515245 + 12345;
+        keys[row]   = (seed >> 8) & (((matrix_row_t)1 << MATRIX_COLS) - 1);
+
+        set_keys(keys, expected);
+        matrix_scan();
+        for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+            EXPECT_EQ(matrix_get_row(r), expected[r]);
+        }
+    }
+}
+
+TEST_F(MatrixPortReads, Benchmark) {
+    static const int SCANS = 20000;
+
+    set_key(1, 3, true);
+    set_key(4, 14, true);
+
+    uint32_t reads = mock_gpio_read_count();
+    auto     start = std::chrono::steady_clock::now();
+    for (int i = 0; i < SCANS; i++) {
+        matrix_scan();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+#if (DIODE_DIRECTION == COL2ROW)
+    const int lines = MATRIX_ROWS;
+#else
+    const int lines = MATRIX_COLS;
+#endif
+    double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << "[ MATRIX   ] " << MATRIX_ROWS << "x" << MATRIX_COLS << std::fixed << std::setprecision(1) << "  reads per line " << std::setw(5) << (double)(mock_gpio_read_count() - reads) / SCANS / lines << "  ns per line " << std::setw(7) << ns / SCANS / lines << std::endl;
+    EXPECT_EQ(matrix_get_row(1), (matrix_row_t)1 << 3);
+}
@@ -0,0 +1,122 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock_gpio.h"
+#ifdef MATRIX_SCAN_MODE_INTERRUPT
+#    include "matrix_interrupt.h"
+#endif
+#include <string.h>
+
+typedef enum { MOCK_PIN_INPUT, MOCK_PIN_INPUT_HIGH, MOCK_PIN_OUTPUT } mock_pin_mode_t;
+
+typedef struct {
+    pin_t a;
+    pin_t b;
+} mock_switch_t;
+
+#define MOCK_GPIO_MAX_SWITCHES 64
+
+static mock_pin_mode_t pin_mode[MOCK_GPIO_PIN_COUNT];
+static bool            pin_output[MOCK_GPIO_PIN_COUNT];
+static bool            pin_event[MOCK_GPIO_PIN_COUNT];
+static bool            pin_event_level[MOCK_GPIO_PIN_COUNT];
+static mock_switch_t   switches[MOCK_GPIO_MAX_SWITCHES];
+static uint8_t         switch_count;
+static uint32_t        read_count;
+
+// Inputs are pulled low through a closed switch to a pin driven low, otherwise pulled high
+static bool pin_level(pin_t pin) {
+    if (pin_mode[pin] == MOCK_PIN_OUTPUT) {
+        return pin_output[pin];
+    }
+    for (uint8_t i = 0; i < switch_count; i++) {
+        pin_t other = switches[i].a == pin ? switches[i].b : (switches[i].b == pin ? switches[i].a : pin);
+        if (other != pin && pin_mode[other] == MOCK_PIN_OUTPUT && !pin_output[other]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Simulate the edge event hardware, firing for any pin whose level changed
+static void update_events(void) {
+    for (pin_t pin = 0; pin < MOCK_GPIO_PIN_COUNT; pin++) {
+        if (pin_event[pin]) {
+            bool level = pin_level(pin);
+            if (level != pin_event_level[pin]) {
+                pin_event_level[pin] = level;
+#ifdef MATRIX_SCAN_MODE_INTERRUPT
+                matrix_interrupt_trigger();
+#endif
+            }
+        }
+    }
+}
+
+void mock_gpio_set_input_high(pin_t pin) {
+    pin_mode[pin] = MOCK_PIN_INPUT_HIGH;
+    update_events();
+}
+
+void mock_gpio_set_output(pin_t pin) {
+    pin_mode[pin] = MOCK_PIN_OUTPUT;
+    update_events();
+}
+
+void mock_gpio_write(pin_t pin, bool level) {
+    pin_output[pin] = level;
+    update_events();
+}
+
+bool mock_gpio_read(pin_t pin) {
+    read_count++;
+    return pin_level(pin);
+}
+
+port_mask_t mock_gpio_read_port(pin_t pin) {
+    port_mask_t state = 0;
+    for (uint8_t pad = 0; pad < 8; pad++) {
+        state |= (port_mask_t)pin_level((pin & 0xF8) | pad) << pad;
+    }
+    read_count++;
+    return state;
+}
+
+void mock_gpio_reset(void) {
+    memset(pin_mode, 0, sizeof(pin_mode));
+    memset(pin_output, 0, sizeof(pin_output));
+    memset(pin_event, 0, sizeof(pin_event));
+    switch_count = 0;
+    read_count   = 0;
+}
+
+void mock_gpio_set_switch(pin_t a, pin_t b, bool closed) {
+    for (uint8_t i = 0; i < switch_count; i++) {
+        if ((switches[i].a == a && switches[i].b == b) || (switches[i].a == b && switches[i].b == a)) {
+            if (!closed) {
+                switches[i] = switches[--switch_count];
+            }
+            update_events();
+            return;
+        }
+    }
+    if (closed && switch_count < MOCK_GPIO_MAX_SWITCHES) {
+        switches[switch_count++] = (mock_switch_t){.a = a, .b = b};
+    }
+    update_events();
+}
+
+uint32_t mock_gpio_read_count(void) {
+    return read_count;
+}
+
+#ifdef MATRIX_SCAN_MODE_INTERRUPT
+void matrix_interrupt_enable_pin(pin_t pin) {
+    pin_event[pin]       = true;
+    pin_event_level[pin] = pin_level(pin);
+}
+
+void matrix_interrupt_disable_pin(pin_t pin) {
+    pin_event[pin] = false;
+}
+#endif
@@ -0,0 +1,36 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+typedef uint8_t port_mask_t;
+
+/* Pins 0 to 63 are available, in ports of 8 pins. Switches connect any two of them. */
+#define MOCK_GPIO_PIN_COUNT 64
+
+#define setPinInputHigh(pin) mock_gpio_set_input_high(pin)
+#define setPinOutput(pin) mock_gpio_set_output(pin)
+#define writePinHigh(pin) mock_gpio_write(pin, true)
+#define writePinLow(pin) mock_gpio_write(pin, false)
+#define readPin(pin) mock_gpio_read(pin)
+
+#define getPinPort(pin) ((pin)&0xF8)
+#define getPinPad(pin) ((pin)&0x7)
+#define readPinPort(pin) mock_gpio_read_port(pin)
+
+void        mock_gpio_set_input_high(pin_t pin);
+void        mock_gpio_set_output(pin_t pin);
+void        mock_gpio_write(pin_t pin, bool level);
+bool        mock_gpio_read(pin_t pin);
+port_mask_t mock_gpio_read_port(pin_t pin);
+
+/* Reset all pins to floating inputs and open all switches. */
+void mock_gpio_reset(void);
+/* Open or close the switch between two pins. */
+void mock_gpio_set_switch(pin_t a, pin_t b, bool closed);
+/* Number of readPin() and readPinPort() calls since the last reset. */
+uint32_t mock_gpio_read_count(void);
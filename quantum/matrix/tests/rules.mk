@@ -0,0 +1,39 @@
+MATRIX_COMMON_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_g.c \
+	$(QUANTUM_PATH)/matrix/tests/mock_gpio.c
+
+matrix_interrupt_col2row_DEFS := -DIGNORE_ATOMIC_BLOCK -DNO_PRINT -DMATRIX_SCAN_MODE_INTERRUPT
+matrix_interrupt_col2row_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock_col2row.h
+matrix_interrupt_col2row_INC := $(QUANTUM_PATH)/matrix/tests
+matrix_interrupt_col2row_SRC := $(MATRIX_COMMON_SRC) \
+	$(QUANTUM_PATH)/matrix_interrupt.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_interrupt_tests.cpp
+
+matrix_interrupt_row2col_DEFS := $(matrix_interrupt_col2row_DEFS)
+matrix_interrupt_row2col_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock_row2col.h
+matrix_interrupt_row2col_INC := $(matrix_interrupt_col2row_INC)
+matrix_interrupt_row2col_SRC := $(matrix_interrupt_col2row_SRC)
+
+matrix_port_reads_col2row_DEFS := -DIGNORE_ATOMIC_BLOCK -DNO_PRINT -DMATRIX_PORT_READS
+matrix_port_reads_col2row_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock_ports_col2row.h
+matrix_port_reads_col2row_INC := $(QUANTUM_PATH)/matrix/tests
+matrix_port_reads_col2row_SRC := $(MATRIX_COMMON_SRC) \
+	$(QUANTUM_PATH)/matrix/tests/matrix_port_reads_tests.cpp
+
+matrix_port_reads_row2col_DEFS := $(matrix_port_reads_col2row_DEFS)
+matrix_port_reads_row2col_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock_ports_row2col.h
+matrix_port_reads_row2col_INC := $(matrix_port_reads_col2row_INC)
+matrix_port_reads_row2col_SRC := $(matrix_port_reads_col2row_SRC)
+
+matrix_pin_reads_col2row_DEFS := -DIGNORE_ATOMIC_BLOCK -DNO_PRINT
+matrix_pin_reads_col2row_CONFIG := $(matrix_port_reads_col2row_CONFIG)
+matrix_pin_reads_col2row_INC := $(matrix_port_reads_col2row_INC)
+matrix_pin_reads_col2row_SRC := $(matrix_port_reads_col2row_SRC)
+
+matrix_pin_reads_row2col_DEFS := $(matrix_pin_reads_col2row_DEFS)
+matrix_pin_reads_row2col_CONFIG := $(matrix_port_reads_row2col_CONFIG)
+matrix_pin_reads_row2col_INC := $(matrix_port_reads_col2row_INC)
+matrix_pin_reads_row2col_SRC := $(matrix_port_reads_col2row_SRC)
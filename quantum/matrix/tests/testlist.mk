@@ -0,0 +1,7 @@
+TEST_LIST += \
+	matrix_interrupt_col2row \
+	matrix_interrupt_row2col \
+	matrix_port_reads_col2row \
+	matrix_port_reads_row2col \
+	matrix_pin_reads_col2row \
+	matrix_pin_reads_row2col
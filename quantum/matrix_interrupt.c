@@ -0,0 +1,51 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Edge event support for the interrupt driven matrix scan mode, see matrix.c.
+
+While no key is pressed, all lines on the output side of the matrix are driven active
+and edge events are enabled on the inputs. Any key press then pulls an input low and
+flags the matrix for a full scan, so matrix_scan() does not need to touch any pins
+until that happens.
+*/
+
+#include "matrix_interrupt.h"
+#include "atomic_util.h"
+
+static volatile bool matrix_interrupt_flag = false;
+
+void matrix_interrupt_trigger(void) {
+    matrix_interrupt_flag = true;
+}
+
+bool matrix_interrupt_triggered(void) {
+    bool triggered;
+    ATOMIC_BLOCK_FORCEON {
+        triggered             = matrix_interrupt_flag;
+        matrix_interrupt_flag = false;
+    }
+    return triggered;
+}
+
+#if defined(PROTOCOL_CHIBIOS)
+#    if !defined(PAL_USE_CALLBACKS) || PAL_USE_CALLBACKS != TRUE
+#        error "MATRIX_SCAN_MODE = interrupt requires `#define PAL_USE_CALLBACKS TRUE` in halconf.h"
+#    endif
+
+static void matrix_interrupt_callback(void *arg) {
+    (void)arg;
+    matrix_interrupt_trigger();
+}
+
+void matrix_interrupt_enable_pin(pin_t pin) {
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    palSetLineCallback(pin, matrix_interrupt_callback, NULL);
+}
+
+void matrix_interrupt_disable_pin(pin_t pin) {
+    palDisableLineEvent(pin);
+}
+#elif defined(__AVR__)
+#    error "MATRIX_SCAN_MODE = interrupt is not supported on AVR"
+#endif
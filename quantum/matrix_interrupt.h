@@ -0,0 +1,32 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+#ifndef MATRIX_INTERRUPT_IDLE_TIME
+#    define MATRIX_INTERRUPT_IDLE_TIME 20
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* enable/disable edge events on a matrix input pin, provided by the platform */
+void matrix_interrupt_enable_pin(pin_t pin);
+void matrix_interrupt_disable_pin(pin_t pin);
+
+/* called from the edge event handler */
+void matrix_interrupt_trigger(void);
+/* returns whether an edge has occurred since the last call */
+bool matrix_interrupt_triggered(void);
+
+/* whether the matrix is idle and waiting for an edge */
+bool matrix_interrupt_is_idle(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -56,6 +56,23 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the number of rendered glyphs that are kept in RAM, already converted to the display's native
+ *      pixel format. Redrawing a cached glyph with the same colors on the same display skips decoding entirely. The
+ *      least recently used glyph is evicted when the cache is full. Defaults to 0, which disables the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+/**
+ * @def This controls the size in bytes of each glyph cache entry. Glyphs whose native pixel data does not fit are
+ *      always decoded. Each entry requires this much RAM, plus some metadata.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE 512
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +89,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT
+/**
+ * @def This controls the number of pixel data buffers. With two or more, the next block of pixel data is decoded while
+ *      the previous one is still being transmitted, for displays whose comms driver supports asynchronous sends. Each
+ *      extra buffer costs QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT 1
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
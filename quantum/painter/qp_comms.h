@@ -16,6 +16,10 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+// Same as qp_comms_send(), but the comms driver may still be transmitting the data when this returns. The data must not
+// be modified until the next comms call on the device, which waits for the transfer to finish first.
+uint32_t qp_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -9,8 +9,8 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter utility functions
 
-// Global variable used for native pixel data streaming.
-extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Global variable used for native pixel data streaming, points at the pixdata buffer currently being filled.
+extern uint8_t* qp_internal_global_pixdata_buffer;
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -18,6 +18,10 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
 // Returns the number of pixels that can fit in the pixdata buffer
 uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device);
 
+// Sends pixels from the current pixdata buffer, then moves on to the next one. With more than one buffer, the comms driver
+// may still be sending the pixels when this returns, so the buffer that was sent must not be written to again.
+bool qp_internal_send_pixdata(painter_device_t device, uint32_t native_pixel_count);
+
 // Fills the supplied buffer with equivalent native pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val);
 
@@ -29,7 +33,7 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint1
 
 // Convert from input pixel data + palette to equivalent pixels
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
-typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg);
 typedef bool (*qp_internal_byte_output_callback)(uint8_t byte, void* cb_arg);
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_pixel_output_callback output_callback, void* output_arg);
@@ -82,7 +86,8 @@ typedef struct qp_internal_pixel_output_state_t {
     uint32_t         max_pixels;
 } qp_internal_pixel_output_state_t;
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+// Appends a span of palette indices to the pixdata buffer, sending it whenever it fills up
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg);
 
 typedef struct qp_internal_byte_output_state_t {
     painter_device_t device;
@@ -93,3 +98,9 @@ typedef struct qp_internal_byte_output_state_t {
 bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
+
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+// Tiled renderers record draw calls, and replay them later -- including single frames of animations
+#    include "qp_tiled_internal.h"
+bool qp_internal_drawimage_frame(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888);
+#endif // QUANTUM_PAINTER_TILED_ENABLE
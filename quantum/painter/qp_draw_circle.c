@@ -133,6 +133,12 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+    if (qp_tiled_is_device(device)) {
+        return qp_tiled_record_shape(device, QP_TILED_CIRCLE, x, y, radius, 0, hue, sat, val, filled);
+    }
+#endif // QUANTUM_PAINTER_TILED_ENABLE
+
     // plot the initial set of points for x, y and r
     int16_t xcalc = 0;
     int16_t ycalc = (int16_t)radius;
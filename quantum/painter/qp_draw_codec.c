@@ -28,10 +28,15 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel) {
     return true;
 }
 
+// Number of palette indices decoded before they're handed to the output callback in one go
+#define QP_INTERNAL_DECODE_SPAN_LENGTH 64
+
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg) {
     const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
     const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
     uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
+    uint8_t       span[QP_INTERNAL_DECODE_SPAN_LENGTH];
+    uint8_t       span_length = 0;
     while (remaining_pixels > 0) {
         int16_t byteval = input_callback(input_arg);
         if (byteval < 0) {
@@ -39,12 +44,18 @@ bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, u
         }
         uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
         for (uint8_t q = 0; q < loop_pixels; ++q) {
-            if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
-                return false;
-            }
+            span[span_length++] = byteval & pixel_bitmask;
             byteval >>= bits_per_pixel;
         }
         remaining_pixels -= loop_pixels;
+
+        // Hand over the span once another byte's worth of pixels won't fit, or there's nothing left to decode
+        if (span_length + pixels_per_byte > QP_INTERNAL_DECODE_SPAN_LENGTH || remaining_pixels == 0) {
+            if (!output_callback(palette, span, span_length, output_arg)) {
+                return false;
+            }
+            span_length = 0;
+        }
     }
     return true;
 }
@@ -125,20 +136,30 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
-        return false;
-    }
-
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+    while (pixel_count > 0) {
+        // Append as much of the span as fits before the transmit limit
+        uint32_t span_length = state->max_pixels - state->pixel_write_pos;
+        if (span_length > pixel_count) {
+            span_length = pixel_count;
+        }
+        if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, span_length, palette_indices)) {
             return false;
         }
-        state->pixel_write_pos = 0;
+        state->pixel_write_pos += span_length;
+        palette_indices += span_length;
+        pixel_count -= span_length;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->pixel_write_pos == state->max_pixels) {
+            if (!qp_internal_send_pixdata(state->device, state->pixel_write_pos)) {
+                return false;
+            }
+            state->pixel_write_pos = 0;
+        }
     }
 
     return true;
@@ -155,7 +176,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->byte_write_pos == state->max_bytes) {
         painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+        if (!qp_internal_send_pixdata(state->device, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
         state->byte_write_pos = 0;
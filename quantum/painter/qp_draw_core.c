@@ -8,6 +8,7 @@
 #include "qgf.h"
 
 _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE % 16) == 0, "QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE needs to be a non-zero multiple of 16");
+_Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT) > 0 && (QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT) < 256, "QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT must be between 1 and 255");
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Global variables
@@ -19,8 +20,10 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 //       **** very likely get artifacts rendered to the screen as a result.                                       ****
 //
 
-// Buffer used for transmitting native pixel data to the downstream device.
-__attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Buffers used for transmitting native pixel data to the downstream device. Pixel data is written to the current one,
+// and qp_internal_send_pixdata() moves on to the next so that the comms driver can still be sending the previous one.
+__attribute__((__aligned__(4))) static uint8_t qp_internal_global_pixdata_buffers[QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t                                       *qp_internal_global_pixdata_buffer = qp_internal_global_pixdata_buffers[0];
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -41,6 +44,19 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+// Sends pixels from the current pixdata buffer, then moves on to the next buffer to fill.
+bool qp_internal_send_pixdata(painter_device_t device, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    bool              ret    = driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, native_pixel_count);
+#if QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT > 1
+    static uint8_t current = 0;
+
+    current                           = (current + 1) % (QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT);
+    qp_internal_global_pixdata_buffer = qp_internal_global_pixdata_buffers[current];
+#endif
+    return ret;
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -150,6 +166,12 @@ bool qp_setpixel(painter_device_t device, uint16_t x, uint16_t y, uint8_t hue, u
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+    if (qp_tiled_is_device(device)) {
+        return qp_tiled_record_shape(device, QP_TILED_SETPIXEL, x, y, x, y, hue, sat, val, true);
+    }
+#endif // QUANTUM_PAINTER_TILED_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("Failed to start comms in qp_setpixel\n");
         return false;
@@ -180,6 +202,12 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+    if (qp_tiled_is_device(device)) {
+        return qp_tiled_record_shape(device, QP_TILED_LINE, x0, y0, x1, y1, hue, sat, val, true);
+    }
+#endif // QUANTUM_PAINTER_TILED_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("Failed to start comms in qp_line\n");
         return false;
@@ -258,6 +286,12 @@ bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t righ
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+    if (qp_tiled_is_device(device)) {
+        return qp_tiled_record_shape(device, QP_TILED_RECT, left, top, right, bottom, hue, sat, val, filled);
+    }
+#endif // QUANTUM_PAINTER_TILED_ENABLE
+
     // Cater for cases where people have submitted the coordinates backwards
     uint16_t l = QP_MIN(left, right);
     uint16_t r = QP_MAX(left, right);
@@ -67,6 +67,12 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+    if (qp_tiled_is_device(device)) {
+        return qp_tiled_record_shape(device, QP_TILED_ELLIPSE, x, y, sizex, sizey, hue, sat, val, filled);
+    }
+#endif // QUANTUM_PAINTER_TILED_ENABLE
+
     int32_t aa = ((int32_t)sizex) * ((int32_t)sizex);
     int32_t bb = ((int32_t)sizey) * ((int32_t)sizey);
     int32_t fa = 4 * aa;
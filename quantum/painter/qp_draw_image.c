@@ -228,11 +228,6 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    if (!qp_comms_start(device)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
-        return false;
-    }
-
     uint16_t l, t, r, b;
     if (frame_info->is_delta) {
         l = x + frame_info->left;
@@ -247,6 +242,18 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     }
     uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
 
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+    // Only the frame info is needed for recording, so that animations still get their frame delays
+    if (qp_tiled_is_device(device)) {
+        return qp_tiled_record_image(device, x, y, l, t, r, b, image, frame_number, fg_hsv888, bg_hsv888);
+    }
+#endif // QUANTUM_PAINTER_TILED_ENABLE
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
+        return false;
+    }
+
     // Configure where we're going to be rendering to
     if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
@@ -272,7 +279,7 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         ret = qp_internal_decode_palette(device, pixel_count, frame_info->bpp, input_callback, &input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            ret &= qp_internal_send_pixdata(device, output_state.pixel_write_pos);
         }
     } else if (frame_info->bpp != driver->native_bits_per_pixel) {
         // Prevent stuff like drawing 24bpp images on 16bpp displays
@@ -287,7 +294,7 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         ret                 = qp_internal_send_bytes(device, byte_count, input_callback, &input_state, qp_internal_byte_appender, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            ret &= qp_internal_send_pixdata(device, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
         }
     }
 
@@ -303,6 +310,13 @@ bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, paint
     return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
 }
 
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+bool qp_internal_drawimage_frame(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    qgf_frame_info_t frame_info = {0};
+    return qp_drawimage_recolor_impl(device, x, y, image, frame_number, &frame_info, fg_hsv888, bg_hsv888);
+}
+#endif // QUANTUM_PAINTER_TILED_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_animate
 
@@ -36,6 +36,109 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Rendered glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+// A glyph rendered in the native pixel format of a device, for a given font and colors
+typedef struct qp_glyph_cache_entry_t {
+    painter_device_t   device;
+    qff_font_handle_t *font;
+    uint32_t           code_point;
+    qp_pixel_t         fg_hsv888;
+    qp_pixel_t         bg_hsv888;
+    uint32_t           last_used; // zero if the entry is unused
+    uint8_t            pixdata[QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static uint32_t               glyph_cache_counter                              = 0;
+
+static void qp_glyph_cache_touch(qp_glyph_cache_entry_t *entry) {
+    // If the counter wraps, restart the ordering of everything cached so far so that zero still means unused
+    if (++glyph_cache_counter == 0) {
+        for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+            if (glyph_cache[i].last_used) {
+                glyph_cache[i].last_used = 1;
+            }
+        }
+        glyph_cache_counter = 2;
+    }
+    entry->last_used = glyph_cache_counter;
+}
+
+// Returns the matching cached glyph, or NULL if it hasn't been rendered yet
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(painter_device_t device, qff_font_handle_t *qff_font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->last_used && entry->device == device && entry->font == qff_font && entry->code_point == code_point && memcmp(&entry->fg_hsv888, &fg_hsv888, sizeof(qp_pixel_t)) == 0 && memcmp(&entry->bg_hsv888, &bg_hsv888, sizeof(qp_pixel_t)) == 0) {
+            qp_glyph_cache_touch(entry);
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Frees up the least recently used entry, so that a new glyph can be rendered into it
+static qp_glyph_cache_entry_t *qp_glyph_cache_evict(void) {
+    qp_glyph_cache_entry_t *entry = &glyph_cache[0];
+    for (int i = 1; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache[i].last_used < entry->last_used) {
+            entry = &glyph_cache[i];
+        }
+    }
+    entry->last_used = 0;
+    return entry;
+}
+
+// Drops all glyphs of a font, as its handle can be reused for a different font once closed
+static void qp_glyph_cache_invalidate(qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].last_used = 0;
+        }
+    }
+}
+
+// Output state and callback used to render a glyph into a cache entry instead of the pixdata buffer
+typedef struct qp_glyph_cache_output_state_t {
+    painter_device_t device;
+    uint8_t *        pixdata;
+    uint32_t         pixel_write_pos;
+} qp_glyph_cache_output_state_t;
+
+static bool qp_glyph_cache_appender(qp_pixel_t *palette, uint8_t *palette_indices, uint32_t pixel_count, void *cb_arg) {
+    qp_glyph_cache_output_state_t *state  = (qp_glyph_cache_output_state_t *)cb_arg;
+    painter_driver_t *             driver = (painter_driver_t *)state->device;
+
+    if (!driver->driver_vtable->append_pixels(state->device, state->pixdata, palette, state->pixel_write_pos, pixel_count, palette_indices)) {
+        return false;
+    }
+    state->pixel_write_pos += pixel_count;
+    return true;
+}
+
+// Streams a cached glyph to the current viewport, copying it to the pixdata buffer a buffer's worth at a time
+static bool qp_glyph_cache_send(painter_device_t device, const qp_glyph_cache_entry_t *entry, uint32_t pixel_count) {
+    painter_driver_t *driver     = (painter_driver_t *)device;
+    uint32_t          max_pixels = qp_internal_num_pixels_in_buffer(device);
+    const uint8_t *   pixdata    = entry->pixdata;
+    while (pixel_count > 0) {
+        uint32_t chunk_pixels = pixel_count < max_pixels ? pixel_count : max_pixels;
+        uint32_t chunk_bytes  = (chunk_pixels * driver->native_bits_per_pixel + 7) / 8;
+        memcpy(qp_internal_global_pixdata_buffer, pixdata, chunk_bytes);
+        if (!qp_internal_send_pixdata(device, chunk_pixels)) {
+            return false;
+        }
+        pixdata += chunk_bytes;
+        pixel_count -= chunk_pixels;
+    }
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -151,6 +254,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Forget any glyphs rendered with this font
+    qp_glyph_cache_invalidate(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -253,19 +361,27 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
                                      + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
                                      + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
 
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
-
+        // The table is sorted by code point (enforced by qff_validate_stream()), so binary search it
         qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+        uint16_t               lower = 0;
+        uint16_t               upper = qff_font->num_unicode_glyphs;
+        while (lower < upper) {
+            uint16_t middle = lower + (upper - lower) / 2;
+            if (qp_stream_setpos(&qff_font->stream, glyph_info_offset + middle * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+                qp_dprintf("Failed to set stream position while preparing glyph data\n");
+                return false;
+            }
+
             if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
                 qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                 return false;
             }
 
-            if (glyph_info.code_point == code_point) {
+            if (glyph_info.code_point < code_point) {
+                lower = middle + 1;
+            } else if (glyph_info.code_point > code_point) {
+                upper = middle;
+            } else {
                 uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
                 uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
                 uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
@@ -345,6 +461,8 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
 } code_point_iter_drawglyph_state_t;
 
 // Codepoint handler callback: drawing
@@ -364,13 +482,35 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph
     uint32_t pixel_count = ((uint32_t)width) * height;
-    bool     ret         = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Glyphs that fit in the cache are only decoded the first time they're drawn, then copied from the cache
+    if ((pixel_count * driver->native_bits_per_pixel + 7) / 8 <= QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE) {
+        qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(state->device, qff_font, code_point, state->fg_hsv888, state->bg_hsv888);
+        if (!entry) {
+            entry                                     = qp_glyph_cache_evict();
+            qp_glyph_cache_output_state_t cache_state = {.device = state->device, .pixdata = entry->pixdata, .pixel_write_pos = 0};
+            if (!qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_glyph_cache_appender, &cache_state)) {
+                return false;
+            }
+            entry->device     = state->device;
+            entry->font       = qff_font;
+            entry->code_point = code_point;
+            entry->fg_hsv888  = state->fg_hsv888;
+            entry->bg_hsv888  = state->bg_hsv888;
+            qp_glyph_cache_touch(entry);
+        }
+        return qp_glyph_cache_send(state->device, entry, pixel_count);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+    // Decode the pixel data for the glyph
+    bool ret = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
 
     // Any leftovers need transmission as well.
     if (ret && state->output_state->pixel_write_pos > 0) {
-        ret &= driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->output_state->pixel_write_pos);
+        ret &= qp_internal_send_pixdata(state->device, state->output_state->pixel_write_pos);
     }
 
     return ret;
@@ -418,6 +558,12 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_TILED_ENABLE
+    if (qp_tiled_is_device(device)) {
+        return qp_tiled_record_text(device, x, y, font, str, (qp_pixel_t){.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}}, (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}});
+    }
+#endif // QUANTUM_PAINTER_TILED_ENABLE
+
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_drawtext_recolor: fail (could not start comms)\n");
         return 0;
@@ -435,6 +581,10 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     // Set up the pixel output state
     qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
+    // Set up the colors
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+
     // Set up the codepoint iteration state
     code_point_iter_drawglyph_state_t state = {// Common
                                                .device = device,
@@ -444,11 +594,12 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
                                                .input_callback = input_callback,
                                                .input_state    = &input_state,
                                                // Output
-                                               .output_state = &output_state};
+                                               .output_state = &output_state,
+                                               // Colors
+                                               .fg_hsv888 = fg_hsv888,
+                                               .bg_hsv888 = bg_hsv888};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
@@ -7,6 +7,7 @@ QUANTUM_PAINTER_LVGL_INTEGRATION ?= no
 # The list of permissible drivers that can be listed in QUANTUM_PAINTER_DRIVERS
 VALID_QUANTUM_PAINTER_DRIVERS := \
     surface \
+    tiled \
     ili9163_spi \
     ili9341_spi \
     ili9488_spi \
@@ -58,6 +59,12 @@ define handle_quantum_painter_driver
     else ifeq ($$(strip $$(CURRENT_PAINTER_DRIVER)),surface)
         QUANTUM_PAINTER_NEEDS_SURFACE := yes
 
+    else ifeq ($$(strip $$(CURRENT_PAINTER_DRIVER)),tiled)
+        QUANTUM_PAINTER_NEEDS_SURFACE := yes
+        OPT_DEFS += -DQUANTUM_PAINTER_TILED_ENABLE
+        SRC += \
+            $(DRIVER_PATH)/painter/generic/qp_tiled.c
+
     else ifeq ($$(strip $$(CURRENT_PAINTER_DRIVER)),ili9163_spi)
         QUANTUM_PAINTER_NEEDS_COMMS_SPI := yes
         QUANTUM_PAINTER_NEEDS_COMMS_SPI_DC_RESET := yes
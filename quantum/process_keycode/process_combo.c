@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -26,6 +27,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#include "debug.h"
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -534,6 +536,48 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
     return key_is_part_of_combo;
 }
 
+#ifdef COMBO_KEYCODE_INDEX
+/* Inverted index from keycode to the combos containing it, so that a key event only
+ * visits candidate combos instead of walking every combo's key list. Keycodes are hashed
+ * into COMBO_KEYCODE_INDEX_BUCKETS buckets, each holding a bitmap of the combos with a key
+ * in that bucket, so candidates are processed in the same order as a linear scan. Combos
+ * sharing a bucket without sharing the key are rejected by process_single_combo(). The
+ * bitmaps are sized at compile time from the keymap's combos, see keymap_introspection.c. */
+#    define COMBO_KEYCODE_INDEX_BUCKET(keycode) (((keycode) ^ ((keycode) >> 8)) & (COMBO_KEYCODE_INDEX_BUCKETS - 1))
+
+_Static_assert((COMBO_KEYCODE_INDEX_BUCKETS & (COMBO_KEYCODE_INDEX_BUCKETS - 1)) == 0 && COMBO_KEYCODE_INDEX_BUCKETS <= 256, "COMBO_KEYCODE_INDEX_BUCKETS must be a power of two, up to 256");
+
+static bool combo_index_available = false;
+
+void combo_keycode_index_reset(void) {
+    uint16_t words = (combo_keycode_index_size_raw() + 31) / 32;
+
+    // Only reachable when combo_count() is overridden, the keymap's own combos always fit
+    combo_index_available = combo_count() <= combo_keycode_index_size_raw();
+    if (!combo_index_available) {
+        dprintf("combo: %u combos exceed COMBO_KEYCODE_INDEX_SIZE, scanning all of them\n", combo_count());
+        return;
+    }
+
+    for (uint16_t bucket = 0; bucket < COMBO_KEYCODE_INDEX_BUCKETS; ++bucket) {
+        memset(combo_keycode_index_bucket_raw(bucket), 0, words * sizeof(uint32_t));
+    }
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; ++i) {
+            combo_keycode_index_bucket_raw(COMBO_KEYCODE_INDEX_BUCKET(key))[idx / 32] |= (uint32_t)1 << (idx % 32);
+        }
+    }
+}
+#endif
+
+void combo_init(void) {
+#ifdef COMBO_KEYCODE_INDEX
+    combo_keycode_index_reset();
+#endif
+}
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
     bool is_combo_key          = false;
     bool no_combo_keys_pressed = true;
@@ -564,10 +608,23 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX
+    if (combo_index_available) {
+        const uint32_t *bucket = combo_keycode_index_bucket_raw(COMBO_KEYCODE_INDEX_BUCKET(keycode));
+        for (uint16_t word = 0; word * 32 < combo_count(); ++word) {
+            for (uint32_t candidates = bucket[word]; candidates; candidates &= candidates - 1) {
+                uint16_t idx = word * 32 + __builtin_ctzl(candidates);
+                is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+            }
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -38,6 +38,9 @@
 #ifndef COMBO_BUFFER_LENGTH
 #    define COMBO_BUFFER_LENGTH 4
 #endif
+#ifndef COMBO_KEYCODE_INDEX_BUCKETS
+#    define COMBO_KEYCODE_INDEX_BUCKETS 32
+#endif
 
 typedef struct combo_t {
     const uint16_t *keys;
@@ -74,9 +77,14 @@ typedef struct combo_t {
 #define KEYCODE_IS_MOD(code) (IS_MODIFIER_KEYCODE(code) || (IS_QK_MODS(code) && !QK_MODS_GET_BASIC_KEYCODE(code)))
 
 bool process_combo(uint16_t keycode, keyrecord_t *record);
+void combo_init(void);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
+#ifdef COMBO_KEYCODE_INDEX
+void combo_keycode_index_reset(void);
+#endif
+
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
@@ -0,0 +1,26 @@
+#pragma once
+
+// Collects the colors produced by a runner, so they can be converted to RGB a batch at a time
+
+typedef struct {
+    HSV     hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+    uint8_t led[RGB_MATRIX_HSV_BATCH_SIZE];
+    uint8_t count;
+} hsv_batch_t;
+
+static void hsv_batch_flush(hsv_batch_t* batch) {
+    RGB rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+    rgb_matrix_hsv_to_rgb_batch(batch->hsv, rgb, batch->count);
+    for (uint8_t j = 0; j < batch->count; j++) {
+        rgb_matrix_set_color(batch->led[j], rgb[j].r, rgb[j].g, rgb[j].b);
+    }
+    batch->count = 0;
+}
+
+static inline void hsv_batch_push(hsv_batch_t* batch, uint8_t led, HSV hsv) {
+    batch->led[batch->count] = led;
+    batch->hsv[batch->count] = hsv;
+    if (++batch->count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        hsv_batch_flush(batch);
+    }
+}
@@ -16,6 +16,80 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
+#        define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
+
+static uint8_t typing_heatmap_spread_amount(uint8_t distance) {
+    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+    }
+    return amount;
+}
+
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_SLIM
+// Keys within the spread of each key, nearest first, generated from the LED layout in info.json.
+// Left undefined for keyboards without one.
+extern const uint16_t       g_typing_heatmap_neighbor_index[] __attribute__((weak));
+extern const led_neighbor_t g_typing_heatmap_neighbors[] __attribute__((weak));
+
+// Whether the generated neighbors match g_led_config, checked when the effect starts
+static bool typing_heatmap_use_neighbors = false;
+
+// Whether the key's LED is within the spread of another one, without the square root of LED_DISTANCE()
+static bool typing_heatmap_within_spread(led_point_t a, led_point_t b) {
+    uint8_t dx = a.x > b.x ? a.x - b.x : b.x - a.x;
+    uint8_t dy = a.y > b.y ? a.y - b.y : b.y - a.y;
+    if (dx >= RGB_MATRIX_TYPING_HEATMAP_SPREAD || dy >= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return false;
+    }
+    return (uint32_t)dx * dx + (uint32_t)dy * dy < (uint32_t)RGB_MATRIX_TYPING_HEATMAP_SPREAD * RGB_MATRIX_TYPING_HEATMAP_SPREAD;
+}
+
+// Every listed neighbor has to have the right distance, and every key within the spread has to be listed
+static bool typing_heatmap_check_neighbors(void) {
+    if (!g_typing_heatmap_neighbor_index || !g_typing_heatmap_neighbors) {
+        return false;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t  led   = g_led_config.matrix_co[row][col];
+            uint16_t key   = row * MATRIX_COLS + col;
+            uint16_t first = pgm_read_word(&g_typing_heatmap_neighbor_index[key]);
+            uint16_t last  = pgm_read_word(&g_typing_heatmap_neighbor_index[key + 1]);
+            if (led == NO_LED) {
+                if (first != last) return false;
+                continue;
+            }
+            uint16_t listed = 0;
+            for (uint16_t i = first; i < last; i++) {
+                led_neighbor_t neighbor;
+                memcpy_P(&neighbor, &g_typing_heatmap_neighbors[i], sizeof(neighbor));
+                uint8_t neighbor_led = g_led_config.matrix_co[neighbor.row][neighbor.col];
+                if (neighbor_led == NO_LED || LED_DISTANCE(g_led_config.point[led], g_led_config.point[neighbor_led]) != neighbor.distance) {
+                    return false;
+                }
+                if (neighbor.distance < RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                    listed++;
+                }
+            }
+            uint16_t within = 0;
+            for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+                for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+                    uint8_t other = g_led_config.matrix_co[i_row][i_col];
+                    if (other != NO_LED && (i_row != row || i_col != col) && typing_heatmap_within_spread(g_led_config.point[led], g_led_config.point[other])) {
+                        within++;
+                    }
+                }
+            }
+            if (listed != within) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+#        endif
+
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
@@ -24,6 +98,21 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
     }
+    if (typing_heatmap_use_neighbors) {
+        g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+
+        uint16_t key  = row * MATRIX_COLS + col;
+        uint16_t last = pgm_read_word(&g_typing_heatmap_neighbor_index[key + 1]);
+        for (uint16_t i = pgm_read_word(&g_typing_heatmap_neighbor_index[key]); i < last; i++) {
+            led_neighbor_t neighbor;
+            memcpy_P(&neighbor, &g_typing_heatmap_neighbors[i], sizeof(neighbor));
+            if (neighbor.distance >= RGB_MATRIX_TYPING_HEATMAP_SPREAD) { // the rest are even further away
+                break;
+            }
+            g_rgb_frame_buffer[neighbor.row][neighbor.col] = qadd8(g_rgb_frame_buffer[neighbor.row][neighbor.col], typing_heatmap_spread_amount(neighbor.distance));
+        }
+        return;
+    }
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
@@ -32,15 +121,9 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
             if (i_row == row && i_col == col) {
                 g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
             } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
                 uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
                 if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
-                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
-                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
-                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
-                    }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], typing_heatmap_spread_amount(distance));
                 }
             }
         }
@@ -59,6 +142,9 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
         memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_SLIM
+        typing_heatmap_use_neighbors = typing_heatmap_check_neighbors();
+#        endif
     }
 
     // The heatmap animation might run in several iterations depending on
@@ -96,5 +182,6 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     return rgb_matrix_check_finished_leds(led_max);
 }
 
+#        undef LED_DISTANCE
 #    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 #endif     // defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
@@ -39,6 +39,17 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Used by the effect runners -- unless RGB_MATRIX_FAST_HSV_BATCH is defined, each color goes through rgb_matrix_hsv_to_rgb() so that overriding it is enough
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+#ifdef RGB_MATRIX_FAST_HSV_BATCH
+    hsv_to_rgb_batch(hsv, rgb, count);
+#else
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+#endif // RGB_MATRIX_FAST_HSV_BATCH
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -69,9 +80,13 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_LED_GEOMETRY
+led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_LED_GEOMETRY
 
 // internals
 static bool            suspend_state     = false;
+static bool            rgb_shutdown      = false;
 static uint8_t         rgb_last_enable   = UINT8_MAX;
 static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
@@ -79,6 +94,9 @@ static rgb_task_states rgb_task_state    = SYNCING;
 #if RGB_MATRIX_TIMEOUT > 0
 static uint32_t rgb_anykey_timer;
 #endif // RGB_MATRIX_TIMEOUT > 0
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+static effect_scheduler_t rgb_scheduler;
+#endif // RGB_MATRIX_SCHEDULER_BUDGET_US
 
 // double buffers
 static uint32_t rgb_timer_buffer;
@@ -147,11 +165,15 @@ void rgb_matrix_update_pwm_buffers(void) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_COMPOSITOR
+    rgb_matrix_compositor_set_color(index, red, green, blue);
+#else
     rgb_matrix_driver.set_color(index, red, green, blue);
+#endif
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#if (defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)) || defined(RGB_MATRIX_COMPOSITOR)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -159,6 +181,34 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #endif
 }
 
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+static void last_hit_push(uint8_t led) {
+    uint8_t slot;
+    if (last_hit_buffer.count < LED_HITS_TO_REMEMBER) {
+        slot = last_hit_slot(&last_hit_buffer, last_hit_buffer.count);
+        last_hit_buffer.count++;
+    } else {
+        // full, so replace the oldest hit
+        slot                 = last_hit_buffer.head;
+        last_hit_buffer.head = last_hit_slot(&last_hit_buffer, 1);
+    }
+    last_hit_buffer.x[slot]       = g_led_config.point[led].x;
+    last_hit_buffer.y[slot]       = g_led_config.point[led].y;
+    last_hit_buffer.index[slot]   = led;
+    last_hit_buffer.tick[slot]    = 0;
+    last_hit_buffer.led_slot[led] = slot;
+}
+
+static void last_hit_init(last_hit_t *hits) {
+    hits->count = 0;
+    hits->head  = 0;
+    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
+        hits->tick[i] = UINT16_MAX;
+    }
+    memset(hits->led_slot, NO_LAST_HIT, sizeof(hits->led_slot));
+}
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
 void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -180,21 +230,8 @@ void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed) {
         led_count = rgb_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
-        last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
-        last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
-        last_hit_buffer.index[index] = led[i];
-        last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
+        last_hit_push(led[i]);
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
@@ -245,6 +282,36 @@ static bool rgb_matrix_none(effect_params_t *params) {
     return false;
 }
 
+#ifdef RGB_MATRIX_COMPOSITOR
+// the settings that the kept effect layer was rendered with
+static HSV         rgb_kept_hsv;
+static uint8_t     rgb_kept_speed;
+static led_flags_t rgb_kept_flags;
+
+// Effects whose output only depends on the settings, so that their layer can be kept until those change
+static bool rgb_effect_is_static(uint8_t effect) {
+    switch (effect) {
+        case RGB_MATRIX_SOLID_COLOR:
+#    ifdef ENABLE_RGB_MATRIX_ALPHAS_MODS
+        case RGB_MATRIX_ALPHAS_MODS:
+#    endif
+#    ifdef ENABLE_RGB_MATRIX_GRADIENT_UP_DOWN
+        case RGB_MATRIX_GRADIENT_UP_DOWN:
+#    endif
+#    ifdef ENABLE_RGB_MATRIX_GRADIENT_LEFT_RIGHT
+        case RGB_MATRIX_GRADIENT_LEFT_RIGHT:
+#    endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool rgb_effect_layer_is_current(uint8_t effect) {
+    return !rgb_effect_params.init && rgb_effect_is_static(effect) && rgb_matrix_compositor_effect_kept() && rgb_kept_flags == rgb_effect_params.flags && rgb_kept_speed == rgb_matrix_config.speed && rgb_kept_hsv.h == rgb_matrix_config.hsv.h && rgb_kept_hsv.s == rgb_matrix_config.hsv.s && rgb_kept_hsv.v == rgb_matrix_config.hsv.v;
+}
+#endif // RGB_MATRIX_COMPOSITOR
+
 static void rgb_task_timers(void) {
 #if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) || RGB_MATRIX_TIMEOUT > 0
     uint32_t deltaTime = sync_timer_elapsed32(rgb_timer_buffer);
@@ -260,13 +327,13 @@ static void rgb_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
+    // hits are kept in order, so only the oldest ones can expire
+    while (last_hit_buffer.count > 0 && UINT16_MAX - deltaTime < last_hit_buffer.tick[last_hit_buffer.head]) {
+        last_hit_buffer.head = last_hit_slot(&last_hit_buffer, 1);
+        last_hit_buffer.count--;
+    }
+    for (uint8_t j = 0; j < last_hit_buffer.count; ++j) {
+        last_hit_buffer.tick[last_hit_slot(&last_hit_buffer, j)] += deltaTime;
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
@@ -281,6 +348,15 @@ static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
 
+#ifdef RGB_MATRIX_COMPOSITOR
+    rgb_matrix_compositor_frame_start();
+#endif // RGB_MATRIX_COMPOSITOR
+
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+    // the limits have to stay the same for all iterations of a frame
+    effect_scheduler_frame_start(&rgb_scheduler);
+#endif // RGB_MATRIX_SCHEDULER_BUDGET_US
+
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -299,6 +375,23 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_COMPOSITOR
+    if (rgb_effect_layer_is_current(effect)) {
+        // the effect layer still holds the last render, so only step through the slices for the indicators
+        RGB_MATRIX_USE_LIMITS_ITER(led_min, led_max, rgb_effect_params.iter);
+        rgb_effect_params.iter++;
+        if (!rgb_matrix_check_finished_leds(led_max)) {
+            rgb_task_state = FLUSHING;
+        }
+        return;
+    }
+    if (rgb_effect_params.iter == 0) {
+        rgb_kept_hsv   = rgb_matrix_config.hsv;
+        rgb_kept_speed = rgb_matrix_config.speed;
+        rgb_kept_flags = rgb_effect_params.flags;
+    }
+#endif // RGB_MATRIX_COMPOSITOR
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -343,6 +436,11 @@ static void rgb_task_render(uint8_t effect) {
 
     // next task
     if (!rendering) {
+#ifdef RGB_MATRIX_COMPOSITOR
+        if (rgb_effect_is_static(effect)) {
+            rgb_matrix_compositor_keep_effect();
+        }
+#endif // RGB_MATRIX_COMPOSITOR
         rgb_task_state = FLUSHING;
         if (!rgb_effect_params.init && effect == RGB_MATRIX_NONE) {
             // We only need to flush once if we are RGB_MATRIX_NONE
@@ -357,41 +455,116 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_enable = rgb_matrix_config.enable;
 
     // update pwm buffers
+#ifdef RGB_MATRIX_COMPOSITOR
+    // nothing to send if no layer changed since the last flush
+    if (rgb_matrix_compositor_blend()) {
+        rgb_matrix_update_pwm_buffers();
+    }
+#else
     rgb_matrix_update_pwm_buffers();
+#endif // RGB_MATRIX_COMPOSITOR
 
     // next task
     rgb_task_state = SYNCING;
 }
 
+static void rgb_task_shutdown(void) {
+#ifdef RGB_MATRIX_COMPOSITOR
+    // drop the indicators
+    rgb_matrix_compositor_frame_start();
+#endif // RGB_MATRIX_COMPOSITOR
+    rgb_task_render(0); // turn off all LEDs
+    rgb_task_flush(0);  // and actually flash led state to LEDs
+    if (rgb_matrix_driver.shutdown) {
+        rgb_matrix_driver.shutdown();
+    }
+    rgb_shutdown = true;
+}
+
+static void rgb_task_exit_shutdown(void) {
+    if (rgb_matrix_driver.exit_shutdown) {
+        rgb_matrix_driver.exit_shutdown();
+    }
+    rgb_shutdown = false;
+    // start the next frame right away rather than waiting for the flush limit
+    rgb_task_state = STARTING;
+}
+
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+static void rgb_task_stats(void) {
+#    if RGB_MATRIX_SCHEDULER_STATS_INTERVAL > 0
+    static uint32_t last_print = 0;
+    if (debug_enable && timer_elapsed32(last_print) >= RGB_MATRIX_SCHEDULER_STATS_INTERVAL) {
+        last_print = timer_read32();
+        effect_scheduler_print(&rgb_scheduler, "rgb matrix");
+    }
+#    endif // RGB_MATRIX_SCHEDULER_STATS_INTERVAL > 0
+}
+
+effect_scheduler_t *rgb_matrix_get_scheduler(void) {
+    return &rgb_scheduler;
+}
+#endif // RGB_MATRIX_SCHEDULER_BUDGET_US
+
 void rgb_matrix_task(void) {
     rgb_task_timers();
 
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if RGB_MATRIX_TIMEOUT > 0
                              (rgb_anykey_timer > (uint32_t)RGB_MATRIX_TIMEOUT) ||
 #endif // RGB_MATRIX_TIMEOUT > 0
                              false;
 
-    uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
+    if (suspend_backlight) {
+        // the LEDs stay off, so there is nothing to render or send until they come back
+        if (!rgb_shutdown) {
+            rgb_task_shutdown();
+        }
+        eeconfig_flush_rgb_matrix(false);
+        return;
+    }
+    if (rgb_shutdown) {
+        rgb_task_exit_shutdown();
+    }
+
+    uint8_t effect = !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
 
     switch (rgb_task_state) {
         case STARTING:
             rgb_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+            struct rgb_matrix_limits_t   limits = rgb_matrix_get_limits(rgb_effect_params.iter);
+            effect_scheduler_timestamp_t start  = effect_scheduler_timestamp();
+#endif // RGB_MATRIX_SCHEDULER_BUDGET_US
             rgb_task_render(effect);
             if (effect) {
+#ifdef RGB_MATRIX_COMPOSITOR
+                rgb_matrix_compositor_select(RGB_MATRIX_LAYER_INDICATORS);
+#endif // RGB_MATRIX_COMPOSITOR
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
                     rgb_matrix_indicators();
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
+#ifdef RGB_MATRIX_COMPOSITOR
+                rgb_matrix_compositor_select(RGB_MATRIX_LAYER_EFFECT);
+#endif // RGB_MATRIX_COMPOSITOR
             }
-            break;
-        case FLUSHING:
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+            effect_scheduler_render_done(&rgb_scheduler, limits.led_min_index, limits.led_max_index, effect_scheduler_elapsed_us(start));
+#endif // RGB_MATRIX_SCHEDULER_BUDGET_US
+        } break;
+        case FLUSHING: {
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+            effect_scheduler_timestamp_t start = effect_scheduler_timestamp();
+#endif // RGB_MATRIX_SCHEDULER_BUDGET_US
             rgb_task_flush(effect);
-            break;
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+            effect_scheduler_flush_done(&rgb_scheduler, effect_scheduler_elapsed_us(start));
+            rgb_task_stats();
+#endif // RGB_MATRIX_SCHEDULER_BUDGET_US
+        } break;
         case SYNCING:
             rgb_task_sync();
             break;
@@ -412,17 +585,22 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#if defined(RGB_MATRIX_SCHEDULER_BUDGET_US) || (defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT)
+#    ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+    uint8_t process_limit = rgb_scheduler.process_limit;
+#    else
+    uint8_t process_limit = RGB_MATRIX_LED_PROCESS_LIMIT;
+#    endif
 #    if defined(RGB_MATRIX_SPLIT)
-    limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
+    limits.led_min_index = process_limit * (iter);
+    limits.led_max_index = limits.led_min_index + process_limit;
     if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
     uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
     if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
     if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
 #    else
-    limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
+    limits.led_min_index = process_limit * (iter);
+    limits.led_max_index = limits.led_min_index + process_limit;
     if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
 #    endif
 #else
@@ -458,19 +636,40 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_LED_GEOMETRY
+void rgb_matrix_update_led_geometry(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx              = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy              = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_led_geometry[i].dx    = dx;
+        g_led_geometry[i].dy    = dy;
+        g_led_geometry[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_led_geometry[i].angle = atan2_8(dy, dx);
+    }
+#    ifdef RGB_MATRIX_COMPOSITOR
+    rgb_matrix_compositor_invalidate_effect();
+#    endif // RGB_MATRIX_COMPOSITOR
+}
+#endif // RGB_MATRIX_LED_GEOMETRY
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        g_last_hit_tracker.tick[i] = UINT16_MAX;
-    }
+#ifdef RGB_MATRIX_COMPOSITOR
+    rgb_matrix_compositor_init();
+#endif // RGB_MATRIX_COMPOSITOR
 
-    last_hit_buffer.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        last_hit_buffer.tick[i] = UINT16_MAX;
-    }
+#ifdef RGB_MATRIX_LED_GEOMETRY
+    rgb_matrix_update_led_geometry();
+#endif // RGB_MATRIX_LED_GEOMETRY
+
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+    effect_scheduler_init(&rgb_scheduler, RGB_MATRIX_SCHEDULER_BUDGET_US, RGB_MATRIX_LED_COUNT, RGB_MATRIX_LED_PROCESS_LIMIT);
+#endif // RGB_MATRIX_SCHEDULER_BUDGET_US
+
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+    last_hit_init(&g_last_hit_tracker);
+    last_hit_init(&last_hit_buffer);
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     if (!eeconfig_is_enabled()) {
@@ -489,9 +688,8 @@ void rgb_matrix_init(void) {
 
 void rgb_matrix_set_suspend_state(bool state) {
 #ifdef RGB_DISABLE_WHEN_USB_SUSPENDED
-    if (state && !suspend_state) { // only run if turning off, and only once
-        rgb_task_render(0);        // turn off all LEDs when suspending
-        rgb_task_flush(0);         // and actually flash led state to LEDs
+    if (state && !rgb_shutdown) { // only run if turning off, and only once
+        rgb_task_shutdown();      // turn off all LEDs and the driver when suspending
     }
     suspend_state = state;
 #endif
@@ -107,6 +107,39 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+// Specializing the effect runners trades flash for speed, so it is left off on AVR by default
+#ifndef RGB_MATRIX_EFFECT_SPECIALIZATION
+#    ifdef __AVR__
+#        define RGB_MATRIX_EFFECT_SPECIALIZATION 0
+#    else
+#        define RGB_MATRIX_EFFECT_SPECIALIZATION 1
+#    endif
+#endif
+
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 16
+#endif
+
+#ifdef RGB_MATRIX_COMPOSITOR
+#    include "rgb_matrix_compositor.h"
+#endif
+
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+#    include "effect_scheduler.h"
+#    ifndef effect_scheduler_timestamp
+#        pragma message "RGB_MATRIX_SCHEDULER_BUDGET_US needs a microsecond timer, which this platform lacks. Using RGB_MATRIX_LED_PROCESS_LIMIT instead."
+#        undef RGB_MATRIX_SCHEDULER_BUDGET_US
+#    endif
+#endif
+
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+
+// Interval at which the frame rate and slice timings are printed to the console while debug is enabled, 0 to disable
+#    ifndef RGB_MATRIX_SCHEDULER_STATS_INTERVAL
+#        define RGB_MATRIX_SCHEDULER_STATS_INTERVAL 10000
+#    endif
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -180,6 +213,12 @@ bool rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
+#ifdef RGB_MATRIX_LED_GEOMETRY
+void rgb_matrix_update_led_geometry(void);
+#endif
+#ifdef RGB_MATRIX_SCHEDULER_BUDGET_US
+effect_scheduler_t *rgb_matrix_get_scheduler(void);
+#endif
 
 void rgb_matrix_reload_from_eeprom(void);
 
@@ -281,6 +320,10 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional: put the hardware in a low power state while the LEDs are off, keeping its buffers. */
+    void (*shutdown)(void);
+    /* Optional: return the hardware to normal operation after shutdown. */
+    void (*exit_shutdown)(void);
 } rgb_matrix_driver_t;
 
 static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
@@ -303,6 +346,26 @@ extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
+
+// Returns the slot holding the j-th oldest hit, for j < hits->count
+static inline uint8_t last_hit_slot(const last_hit_t *hits, uint8_t j) {
+    uint8_t slot = hits->head + j;
+    return slot < LED_HITS_TO_REMEMBER ? slot : slot - LED_HITS_TO_REMEMBER;
+}
+
+// Returns the tick of the most recent hit of the given LED, or UINT16_MAX if it is not remembered
+static inline uint16_t last_hit_led_tick(const last_hit_t *hits, uint8_t led) {
+    uint8_t slot = hits->led_slot[led];
+    if (slot == NO_LAST_HIT || hits->index[slot] != led) {
+        return UINT16_MAX;
+    }
+    // the slot may also have expired without being reused
+    uint8_t age = slot >= hits->head ? slot - hits->head : slot + LED_HITS_TO_REMEMBER - hits->head;
+    return age < hits->count ? hits->tick[slot] : UINT16_MAX;
+}
+#endif
+#ifdef RGB_MATRIX_LED_GEOMETRY
+extern led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT];
 #endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
@@ -0,0 +1,143 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+#ifdef RGB_MATRIX_COMPOSITOR
+
+#    include <string.h>
+#    include <lib/lib8tion/lib8tion.h>
+
+#    define LED_MASK_SIZE ((RGB_MATRIX_LED_COUNT + 7) / 8)
+
+typedef struct {
+    RGB     led[RGB_MATRIX_LED_COUNT];
+    uint8_t set[LED_MASK_SIZE];   // LEDs drawn on the layer
+    uint8_t shown[LED_MASK_SIZE]; // LEDs that were set at the last blend
+    uint8_t dirty[LED_MASK_SIZE]; // LEDs drawn with a new color since the last blend
+    uint8_t blend;
+} rgb_matrix_layer_data_t;
+
+static rgb_matrix_layer_data_t layers[RGB_MATRIX_LAYER_COUNT];
+static rgb_matrix_layer_t      selected_layer = RGB_MATRIX_LAYER_EFFECT;
+static bool                    effect_kept    = false; // the effect layer holds a complete render that nothing has drawn over since
+
+void rgb_matrix_compositor_init(void) {
+    memset(layers, 0, sizeof(layers));
+    layers[RGB_MATRIX_LAYER_EFFECT].blend     = RGB_MATRIX_BLEND_REPLACE;
+    layers[RGB_MATRIX_LAYER_OVERLAY].blend    = RGB_MATRIX_BLEND_ADD;
+    layers[RGB_MATRIX_LAYER_INDICATORS].blend = RGB_MATRIX_BLEND_REPLACE;
+
+    // the effect layer always covers every LED, and nothing has been sent to the driver yet
+    memset(layers[RGB_MATRIX_LAYER_EFFECT].set, 0xFF, LED_MASK_SIZE);
+    memset(layers[RGB_MATRIX_LAYER_EFFECT].dirty, 0xFF, LED_MASK_SIZE);
+    selected_layer = RGB_MATRIX_LAYER_EFFECT;
+    effect_kept    = false;
+}
+
+void rgb_matrix_compositor_select(rgb_matrix_layer_t layer) {
+    if (layer < RGB_MATRIX_LAYER_COUNT) selected_layer = layer;
+}
+
+rgb_matrix_layer_t rgb_matrix_compositor_selected(void) {
+    return selected_layer;
+}
+
+void rgb_matrix_compositor_set_blend(rgb_matrix_layer_t layer, rgb_matrix_blend_t blend) {
+    if (layer < RGB_MATRIX_LAYER_COUNT) {
+        layers[layer].blend = blend;
+        // every LED on the layer now blends differently
+        memcpy(layers[layer].dirty, layers[layer].set, LED_MASK_SIZE);
+    }
+}
+
+void rgb_matrix_compositor_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) return;
+
+    rgb_matrix_layer_data_t *layer = &layers[selected_layer];
+    uint8_t                  byte  = index / 8;
+    uint8_t                  bit   = 1 << (index % 8);
+    RGB                     *led   = &layer->led[index];
+
+    if (!(layer->shown[byte] & bit) || led->r != red || led->g != green || led->b != blue) {
+        led->r = red;
+        led->g = green;
+        led->b = blue;
+        layer->dirty[byte] |= bit;
+        if (selected_layer == RGB_MATRIX_LAYER_EFFECT) {
+            effect_kept = false;
+        }
+    }
+    layer->set[byte] |= bit;
+}
+
+void rgb_matrix_compositor_keep_effect(void) {
+    effect_kept = true;
+}
+
+void rgb_matrix_compositor_invalidate_effect(void) {
+    effect_kept = false;
+}
+
+bool rgb_matrix_compositor_effect_kept(void) {
+    return effect_kept;
+}
+
+void rgb_matrix_compositor_frame_start(void) {
+    for (uint8_t i = RGB_MATRIX_LAYER_EFFECT + 1; i < RGB_MATRIX_LAYER_COUNT; i++) {
+        memset(layers[i].set, 0, LED_MASK_SIZE);
+    }
+}
+
+static void blend_led(RGB *out, const RGB *led, uint8_t blend) {
+    switch (blend) {
+        case RGB_MATRIX_BLEND_ADD:
+            out->r = qadd8(out->r, led->r);
+            out->g = qadd8(out->g, led->g);
+            out->b = qadd8(out->b, led->b);
+            break;
+        case RGB_MATRIX_BLEND_MAX:
+            out->r = MAX(out->r, led->r);
+            out->g = MAX(out->g, led->g);
+            out->b = MAX(out->b, led->b);
+            break;
+        default:
+            *out = *led;
+            break;
+    }
+}
+
+bool rgb_matrix_compositor_blend(void) {
+    bool changed = false;
+
+    for (uint8_t byte = 0; byte < LED_MASK_SIZE; byte++) {
+        // an LED has to be blended again if it was redrawn, or appeared on or disappeared from a layer
+        uint8_t dirty = 0;
+        for (uint8_t l = 0; l < RGB_MATRIX_LAYER_COUNT; l++) {
+            dirty |= layers[l].dirty[byte] | (layers[l].set[byte] ^ layers[l].shown[byte]);
+        }
+        if (!dirty) continue;
+
+        for (uint8_t i = byte * 8; dirty && i < RGB_MATRIX_LED_COUNT; i++, dirty >>= 1) {
+            if (!(dirty & 1)) continue;
+
+            uint8_t bit = 1 << (i % 8);
+            RGB     out = {0};
+            for (uint8_t l = 0; l < RGB_MATRIX_LAYER_COUNT; l++) {
+                if (layers[l].set[byte] & bit) {
+                    blend_led(&out, &layers[l].led[i], layers[l].blend);
+                }
+            }
+            rgb_matrix_driver.set_color(i, out.r, out.g, out.b);
+        }
+        changed = true;
+
+        for (uint8_t l = 0; l < RGB_MATRIX_LAYER_COUNT; l++) {
+            layers[l].shown[byte] = layers[l].set[byte];
+            layers[l].dirty[byte] = 0;
+        }
+    }
+    return changed;
+}
+
+#endif // RGB_MATRIX_COMPOSITOR
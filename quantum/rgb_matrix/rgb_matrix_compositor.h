@@ -0,0 +1,59 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * With RGB_MATRIX_COMPOSITOR, rgb_matrix_set_color() draws into one of several layers instead of
+ * the driver. The effect keeps its own layer between frames, while the overlay and indicator
+ * layers only hold what has been drawn on them during the current frame. Before the flush, the
+ * layers are blended and only the LEDs that changed on any layer are written to the driver.
+ *
+ * Effects whose output only depends on the settings are not rendered again while their layer is
+ * kept, that is until the settings change or something else draws on the effect layer.
+ */
+
+typedef enum {
+    RGB_MATRIX_LAYER_EFFECT,     // drawn by the current effect
+    RGB_MATRIX_LAYER_OVERLAY,    // redrawn every frame, blended on top of the effect
+    RGB_MATRIX_LAYER_INDICATORS, // redrawn every frame, default for the indicator callbacks
+    RGB_MATRIX_LAYER_COUNT,
+} rgb_matrix_layer_t;
+
+typedef enum {
+    RGB_MATRIX_BLEND_REPLACE, // the layer hides the ones below it
+    RGB_MATRIX_BLEND_ADD,     // adds to the layers below it, saturating at full brightness
+    RGB_MATRIX_BLEND_MAX,     // keeps the brightest value of each channel
+} rgb_matrix_blend_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void rgb_matrix_compositor_init(void);
+
+/* selects the layer that rgb_matrix_set_color() draws into */
+void               rgb_matrix_compositor_select(rgb_matrix_layer_t layer);
+rgb_matrix_layer_t rgb_matrix_compositor_selected(void);
+
+void rgb_matrix_compositor_set_blend(rgb_matrix_layer_t layer, rgb_matrix_blend_t blend);
+void rgb_matrix_compositor_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+
+/* marks the effect layer as a complete render of a static effect, which is kept until it is drawn over */
+void rgb_matrix_compositor_keep_effect(void);
+/* has the effect rendered again on the next frame, e.g. after changing g_led_config */
+void rgb_matrix_compositor_invalidate_effect(void);
+bool rgb_matrix_compositor_effect_kept(void);
+
+/* starts a new frame, clearing the overlay and indicator layers */
+void rgb_matrix_compositor_frame_start(void);
+
+/* writes the LEDs that changed on any layer to the driver, returns false if there were none */
+bool rgb_matrix_compositor_blend(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,7 +19,7 @@
 
 /* Each driver needs to define the struct
  *    const rgb_matrix_driver_t rgb_matrix_driver;
- * All members must be provided.
+ * All members must be provided, except for shutdown and exit_shutdown.
  * Keyboard custom drivers can define this in their own files, it should only
  * be here if shared between boards.
  */
@@ -30,6 +30,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3218_update_pwm_buffers,
     .set_color     = is31fl3218_set_color,
     .set_color_all = is31fl3218_set_color_all,
+    .shutdown      = is31fl3218_sw_shutdown,
+    .exit_shutdown = is31fl3218_sw_return_normal,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3731)
@@ -38,6 +40,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3731_flush,
     .set_color     = is31fl3731_set_color,
     .set_color_all = is31fl3731_set_color_all,
+    .shutdown      = is31fl3731_sw_shutdown_drivers,
+    .exit_shutdown = is31fl3731_sw_return_normal_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3733)
@@ -46,6 +50,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3733_flush,
     .set_color     = is31fl3733_set_color,
     .set_color_all = is31fl3733_set_color_all,
+    .shutdown      = is31fl3733_sw_shutdown_drivers,
+    .exit_shutdown = is31fl3733_sw_return_normal_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3736)
@@ -54,6 +60,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3736_flush,
     .set_color     = is31fl3736_set_color,
     .set_color_all = is31fl3736_set_color_all,
+    .shutdown      = is31fl3736_sw_shutdown_drivers,
+    .exit_shutdown = is31fl3736_sw_return_normal_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3737)
@@ -62,6 +70,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3737_flush,
     .set_color     = is31fl3737_set_color,
     .set_color_all = is31fl3737_set_color_all,
+    .shutdown      = is31fl3737_sw_shutdown_drivers,
+    .exit_shutdown = is31fl3737_sw_return_normal_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3741)
@@ -70,6 +80,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3741_flush,
     .set_color     = is31fl3741_set_color,
     .set_color_all = is31fl3741_set_color_all,
+    .shutdown      = is31fl3741_sw_shutdown_drivers,
+    .exit_shutdown = is31fl3741_sw_return_normal_drivers,
 };
 
 #elif defined(IS31FLCOMMON)
@@ -78,6 +90,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = IS31FL_common_flush,
     .set_color     = IS31FL_RGB_set_color,
     .set_color_all = IS31FL_RGB_set_color_all,
+    .shutdown      = IS31FL_common_sw_shutdown_drivers,
+    .exit_shutdown = IS31FL_common_sw_return_normal_drivers,
 };
 
 #elif defined(RGB_MATRIX_SNLED27351)
@@ -86,6 +100,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = snled27351_flush,
     .set_color     = snled27351_set_color,
     .set_color_all = snled27351_set_color_all,
+    .shutdown      = snled27351_sw_shutdown_drivers,
+    .exit_shutdown = snled27351_sw_return_normal_drivers,
 };
 
 #elif defined(RGB_MATRIX_AW20216S)
@@ -94,6 +110,8 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = aw20216s_flush,
     .set_color     = aw20216s_set_color,
     .set_color_all = aw20216s_set_color_all,
+    .shutdown      = aw20216s_sw_shutdown_drivers,
+    .exit_shutdown = aw20216s_sw_return_normal_drivers,
 };
 
 #elif defined(RGB_MATRIX_WS2812)
@@ -31,13 +31,20 @@
 #endif // LED_HITS_TO_REMEMBER
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+#    define NO_LAST_HIT 255
+
+// Ring buffer of the most recent hits, use last_hit_slot() to find the j-th oldest one
 typedef struct PACKED {
     uint8_t  count;
+    uint8_t  head;
     uint8_t  x[LED_HITS_TO_REMEMBER];
     uint8_t  y[LED_HITS_TO_REMEMBER];
     uint8_t  index[LED_HITS_TO_REMEMBER];
     uint16_t tick[LED_HITS_TO_REMEMBER];
+    uint8_t  led_slot[RGB_MATRIX_LED_COUNT]; // slot of the most recent hit of each LED, or NO_LAST_HIT
 } last_hit_t;
+
+_Static_assert(LED_HITS_TO_REMEMBER <= 128, "LED_HITS_TO_REMEMBER must not be larger than 128");
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 typedef enum rgb_task_states { STARTING, RENDERING, FLUSHING, SYNCING } rgb_task_states;
@@ -67,6 +74,23 @@ typedef struct PACKED {
 
 #define NO_LED 255
 
+#ifdef RGB_MATRIX_LED_GEOMETRY
+// Position of an LED relative to the matrix center, see rgb_matrix_update_led_geometry()
+typedef struct PACKED {
+    int16_t dx;
+    int16_t dy;
+    uint8_t dist;
+    uint8_t angle;
+} led_geometry_t;
+#endif // RGB_MATRIX_LED_GEOMETRY
+
+// A key with an LED near another one, and the distance between their LEDs
+typedef struct PACKED {
+    uint8_t row;
+    uint8_t col;
+    uint8_t distance;
+} led_neighbor_t;
+
 typedef struct PACKED {
     uint8_t     matrix_co[MATRIX_ROWS][MATRIX_COLS];
     led_point_t point[RGB_MATRIX_LED_COUNT];
@@ -0,0 +1,75 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+extern "C" {
+#include "color.h"
+}
+
+TEST(HsvToRgbBatch, MatchesHsvToRgb) {
+    HSV hsv[256];
+    RGB rgb[256];
+    for (int s = 0; s < 256; s++) {
+        for (int v = 0; v < 256; v++) {
+            for (int h = 0; h < 256; h++) {
+                hsv[h] = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            hsv_to_rgb_batch(hsv, rgb, 256);
+            for (int h = 0; h < 256; h++) {
+                RGB expected = hsv_to_rgb(hsv[h]);
+                ASSERT_EQ(rgb[h].r, expected.r) << "hsv " << h << "," << s << "," << v;
+                ASSERT_EQ(rgb[h].g, expected.g) << "hsv " << h << "," << s << "," << v;
+                ASSERT_EQ(rgb[h].b, expected.b) << "hsv " << h << "," << s << "," << v;
+            }
+        }
+    }
+}
+
+TEST(HsvToRgbBatch, EmptyBatch) {
+    RGB rgb = {};
+    hsv_to_rgb_batch(nullptr, &rgb, 0);
+    EXPECT_EQ(rgb.r, 0);
+    EXPECT_EQ(rgb.g, 0);
+    EXPECT_EQ(rgb.b, 0);
+}
+
+TEST(HsvToRgbBatch, Benchmark) {
+    static const int LEDS   = 16;
+    static const int ROUNDS = 200000;
+    std::vector<HSV> hsv(LEDS * 64);
+    std::vector<RGB> rgb(hsv.size());
+    uint32_t         seed = 0x5eed;
+    for (auto &color : hsv) {
+        seed  = seed * 1103515245 + 12345;
+        color = {(uint8_t)(seed >> 8), (uint8_t)(seed >> 16), (uint8_t)(seed >> 24)};
+    }
+
+    uint32_t sink  = 0;
+    auto     start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        size_t offset = (round % 64) * LEDS;
+        for (int i = 0; i < LEDS; i++) {
+            rgb[offset + i] = hsv_to_rgb(hsv[offset + i]);
+        }
+        sink += rgb[offset].r;
+    }
+    auto   end    = std::chrono::steady_clock::now();
+    double single = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        size_t offset = (round % 64) * LEDS;
+        hsv_to_rgb_batch(&hsv[offset], &rgb[offset], LEDS);
+        sink += rgb[offset].r;
+    }
+    end          = std::chrono::steady_clock::now();
+    double batch = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    std::cout << "[ HSV2RGB  ] ns per LED" << std::fixed << std::setprecision(2) << "  hsv_to_rgb " << std::setw(6) << single / ROUNDS / LEDS << "  hsv_to_rgb_batch " << std::setw(6) << batch / ROUNDS / LEDS << "  (" << sink % 2 << ")" << std::endl;
+}
@@ -0,0 +1,174 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#define _Static_assert static_assert
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+
+void set_time(uint32_t t);
+
+static int     indicator_led = -1;
+static int     overlay_led   = -1;
+static uint8_t overlay_value = 0;
+
+bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    if (indicator_led >= 0) {
+        rgb_matrix_set_color(indicator_led, 255, 0, 0);
+    }
+    if (overlay_led >= 0) {
+        rgb_matrix_compositor_select(RGB_MATRIX_LAYER_OVERLAY);
+        rgb_matrix_set_color(overlay_led, overlay_value, overlay_value, overlay_value);
+    }
+    return false;
+}
+
+/* counts how often the effects convert their colors, i.e. how often they are rendered */
+static int hsv_conversions = 0;
+
+RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+    hsv_conversions++;
+    return hsv_to_rgb(hsv);
+}
+}
+
+class RgbMatrixCompositor : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        indicator_led = -1;
+        overlay_led   = -1;
+        set_time(0);
+        mock_rgb_matrix_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 128);
+        // a still image, so that nothing changes between frames unless a test changes it
+        rgb_matrix_set_speed_noeeprom(0);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+    }
+};
+
+TEST_F(RgbMatrixCompositor, UnchangedFramesAreNotSent) {
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(mock_rgb_matrix_write_count(), RGB_MATRIX_LED_COUNT);
+    EXPECT_EQ(mock_rgb_matrix_flush_count(), 1);
+
+    uint32_t writes = mock_rgb_matrix_write_count();
+    for (int frame = 0; frame < 10; frame++) {
+        mock_rgb_matrix_render_frame();
+    }
+    EXPECT_EQ(mock_rgb_matrix_write_count(), writes);
+    EXPECT_EQ(mock_rgb_matrix_flush_count(), 1);
+}
+
+TEST_F(RgbMatrixCompositor, OnlyChangedLedsAreSent) {
+    mock_rgb_matrix_render_frame();
+    mock_led_t effect[RGB_MATRIX_LED_COUNT];
+    memcpy(effect, mock_leds, sizeof(effect));
+
+    uint32_t writes = mock_rgb_matrix_write_count();
+    indicator_led   = 5;
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(mock_rgb_matrix_write_count(), writes + 1);
+    EXPECT_EQ(mock_rgb_matrix_flush_count(), 2);
+    EXPECT_EQ(mock_leds[5].r, 255);
+    EXPECT_EQ(mock_leds[5].g, 0);
+    EXPECT_EQ(mock_leds[5].b, 0);
+
+    // the indicator stays the same, so there is nothing to send
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(mock_rgb_matrix_write_count(), writes + 1);
+    EXPECT_EQ(mock_rgb_matrix_flush_count(), 2);
+
+    // once it is no longer drawn, the effect shows through again
+    indicator_led = -1;
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(mock_rgb_matrix_write_count(), writes + 2);
+    EXPECT_EQ(mock_rgb_matrix_flush_count(), 3);
+    EXPECT_EQ(memcmp(mock_leds, effect, sizeof(effect)), 0);
+}
+
+TEST_F(RgbMatrixCompositor, OverlayAddsToEffect) {
+    mock_rgb_matrix_render_frame();
+    mock_led_t effect = mock_leds[7];
+
+    overlay_led   = 7;
+    overlay_value = 100;
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(mock_leds[7].r, effect.r + 100 > 255 ? 255 : effect.r + 100);
+    EXPECT_EQ(mock_leds[7].g, effect.g + 100 > 255 ? 255 : effect.g + 100);
+    EXPECT_EQ(mock_leds[7].b, effect.b + 100 > 255 ? 255 : effect.b + 100);
+
+    rgb_matrix_compositor_set_blend(RGB_MATRIX_LAYER_OVERLAY, RGB_MATRIX_BLEND_MAX);
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(mock_leds[7].r, effect.r > 100 ? effect.r : 100);
+    EXPECT_EQ(mock_leds[7].g, effect.g > 100 ? effect.g : 100);
+    EXPECT_EQ(mock_leds[7].b, effect.b > 100 ? effect.b : 100);
+}
+
+TEST_F(RgbMatrixCompositor, IndicatorsCoverOverlay) {
+    indicator_led = 3;
+    overlay_led   = 3;
+    overlay_value = 50;
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(mock_leds[3].r, 255);
+    EXPECT_EQ(mock_leds[3].g, 0);
+    EXPECT_EQ(mock_leds[3].b, 0);
+}
+
+TEST_F(RgbMatrixCompositor, EffectChangesAreSent) {
+    mock_rgb_matrix_render_frame();
+    uint32_t writes = mock_rgb_matrix_write_count();
+
+    rgb_matrix_sethsv_noeeprom(0, 255, 200);
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(mock_rgb_matrix_flush_count(), 2);
+    EXPECT_GT(mock_rgb_matrix_write_count(), writes);
+
+    // outside of the indicator callbacks, LEDs are drawn on the effect layer
+    EXPECT_EQ(rgb_matrix_compositor_selected(), RGB_MATRIX_LAYER_EFFECT);
+}
+
+TEST_F(RgbMatrixCompositor, StaticEffectIsNotRenderedAgain) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    mock_rgb_matrix_render_frame();
+    mock_rgb_matrix_render_frame();
+    mock_led_t effect = mock_leds[0];
+
+    hsv_conversions = 0;
+    for (int frame = 0; frame < 10; frame++) {
+        mock_rgb_matrix_render_frame();
+    }
+    EXPECT_EQ(hsv_conversions, 0);
+
+    // the indicators are still drawn on top of the kept layer
+    indicator_led = 5;
+    EXPECT_TRUE(mock_rgb_matrix_render_frame());
+    EXPECT_EQ(mock_leds[5].r, 255);
+    EXPECT_EQ(hsv_conversions, 0);
+
+    // changing the settings renders the effect again
+    rgb_matrix_sethsv_noeeprom(85, 255, 128);
+    EXPECT_TRUE(mock_rgb_matrix_render_frame());
+    EXPECT_GT(hsv_conversions, 0);
+    EXPECT_NE(memcmp(&mock_leds[0], &effect, sizeof(effect)), 0);
+}
+
+TEST_F(RgbMatrixCompositor, DrawingOverStaticEffectRendersItAgain) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    mock_rgb_matrix_render_frame();
+    mock_rgb_matrix_render_frame();
+    mock_led_t effect = mock_leds[2];
+
+    // outside of the task, LEDs are drawn on the effect layer
+    rgb_matrix_set_color(2, 1, 2, 3);
+    hsv_conversions = 0;
+    mock_rgb_matrix_render_frame();
+    EXPECT_GT(hsv_conversions, 0);
+    EXPECT_EQ(memcmp(&mock_leds[2], &effect, sizeof(effect)), 0);
+}
@@ -0,0 +1,153 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#define _Static_assert static_assert
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+#include "rgb_matrix_mock.h"
+
+extern const led_point_t k_rgb_matrix_center;
+
+void set_time(uint32_t t);
+}
+
+class RgbMatrixEffects : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        mock_rgb_matrix_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_set_speed_noeeprom(128);
+    }
+
+    void expect_leds(HSV (*reference)(uint8_t i, uint8_t time)) {
+        uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            RGB rgb = hsv_to_rgb(reference(i, time));
+            EXPECT_EQ(mock_leds[i].r, rgb.r) << "led " << (int)i;
+            EXPECT_EQ(mock_leds[i].g, rgb.g) << "led " << (int)i;
+            EXPECT_EQ(mock_leds[i].b, rgb.b) << "led " << (int)i;
+        }
+    }
+
+    static int16_t led_dx(uint8_t i) {
+        return g_led_config.point[i].x - k_rgb_matrix_center.x;
+    }
+
+    static int16_t led_dy(uint8_t i) {
+        return g_led_config.point[i].y - k_rgb_matrix_center.y;
+    }
+};
+
+#ifdef RGB_MATRIX_LED_GEOMETRY
+TEST_F(RgbMatrixEffects, GeometryMatchesLedConfig) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = led_dx(i);
+        int16_t dy = led_dy(i);
+        EXPECT_EQ(g_led_geometry[i].dx, dx);
+        EXPECT_EQ(g_led_geometry[i].dy, dy);
+        EXPECT_EQ(g_led_geometry[i].dist, sqrt16(dx * dx + dy * dy));
+        EXPECT_EQ(g_led_geometry[i].angle, atan2_8(dy, dx));
+    }
+}
+
+TEST_F(RgbMatrixEffects, GeometryFollowsLedConfigUpdates) {
+    g_led_config.point[0].x = k_rgb_matrix_center.x + 30;
+    g_led_config.point[0].y = k_rgb_matrix_center.y + 40;
+    rgb_matrix_update_led_geometry();
+    EXPECT_EQ(g_led_geometry[0].dx, 30);
+    EXPECT_EQ(g_led_geometry[0].dy, 40);
+    EXPECT_EQ(g_led_geometry[0].dist, 50);
+}
+#endif // RGB_MATRIX_LED_GEOMETRY
+
+TEST_F(RgbMatrixEffects, CyclePinwheel) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_PINWHEEL);
+    for (int frame = 0; frame < 20; frame++) {
+        mock_rgb_matrix_render_frame();
+        expect_leds([](uint8_t i, uint8_t time) -> HSV {
+            return {(uint8_t)(atan2_8(led_dy(i), led_dx(i)) + time), 255, 255};
+        });
+    }
+}
+
+TEST_F(RgbMatrixEffects, CycleSpiral) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_SPIRAL);
+    for (int frame = 0; frame < 20; frame++) {
+        mock_rgb_matrix_render_frame();
+        expect_leds([](uint8_t i, uint8_t time) -> HSV {
+            int16_t dx = led_dx(i);
+            int16_t dy = led_dy(i);
+            return {(uint8_t)(sqrt16(dx * dx + dy * dy) - time - atan2_8(dy, dx)), 255, 255};
+        });
+    }
+}
+
+TEST_F(RgbMatrixEffects, CycleOutIn) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_OUT_IN);
+    for (int frame = 0; frame < 20; frame++) {
+        mock_rgb_matrix_render_frame();
+        expect_leds([](uint8_t i, uint8_t time) -> HSV {
+            int16_t dx   = led_dx(i);
+            int16_t dy   = led_dy(i);
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+            return {(uint8_t)(3 * dist / 2 + time), 255, 255};
+        });
+    }
+}
+
+TEST_F(RgbMatrixEffects, Benchmark) {
+    static const int FRAMES = 2000;
+    static const struct {
+        uint8_t     mode;
+        const char *name;
+    } effects[] = {
+        {RGB_MATRIX_CYCLE_LEFT_RIGHT, "CYCLE_LEFT_RIGHT"},
+        {RGB_MATRIX_CYCLE_OUT_IN, "CYCLE_OUT_IN"},
+        {RGB_MATRIX_CYCLE_OUT_IN_DUAL, "CYCLE_OUT_IN_DUAL"},
+        {RGB_MATRIX_CYCLE_PINWHEEL, "CYCLE_PINWHEEL"},
+        {RGB_MATRIX_CYCLE_SPIRAL, "CYCLE_SPIRAL"},
+        {RGB_MATRIX_BAND_PINWHEEL_SAT, "BAND_PINWHEEL_SAT"},
+        {RGB_MATRIX_BAND_PINWHEEL_VAL, "BAND_PINWHEEL_VAL"},
+        {RGB_MATRIX_BAND_SPIRAL_SAT, "BAND_SPIRAL_SAT"},
+        {RGB_MATRIX_BAND_SPIRAL_VAL, "BAND_SPIRAL_VAL"},
+        {RGB_MATRIX_RAINBOW_BEACON, "RAINBOW_BEACON"},
+        {RGB_MATRIX_SOLID_REACTIVE_SIMPLE, "SOLID_REACTIVE_SIMPLE"},
+        {RGB_MATRIX_SOLID_REACTIVE_WIDE, "SOLID_REACTIVE_WIDE"},
+        {RGB_MATRIX_SPLASH, "SPLASH"},
+        {RGB_MATRIX_MULTISPLASH, "MULTISPLASH"},
+    };
+
+#ifdef RGB_MATRIX_LED_GEOMETRY
+    const char *geometry = "table";
+#else
+    const char *geometry = "computed";
+#endif
+    for (auto &effect : effects) {
+        rgb_matrix_mode_noeeprom(effect.mode);
+        mock_rgb_matrix_render_frame();
+
+        double ns = 0;
+        for (int frame = 0; frame < FRAMES; frame++) {
+            if (frame % 4 == 0) {
+                /* keep the hit tracker full for the reactive effects */
+                process_rgb_matrix(frame / 4 % MATRIX_ROWS, frame / 4 % MATRIX_COLS, true);
+            }
+            auto start = std::chrono::steady_clock::now();
+            mock_rgb_matrix_render_frame();
+            auto end = std::chrono::steady_clock::now();
+            ns += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        }
+        std::cout << "[ RGB      ] " << RGB_MATRIX_LED_COUNT << " leds, geometry " << std::left << std::setw(9) << geometry << std::setw(22) << effect.name << std::right << std::fixed << std::setprecision(1) << " ns per frame " << std::setw(8) << ns / FRAMES << std::endl;
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "rgb_matrix.h"
+#include "eeconfig.h"
+#include "rgb_matrix_mock.h"
+
+void advance_time(uint32_t ms);
+
+/* more task calls than any frame takes, even when rendered one LED at a time, so that frames which are not sent end too */
+#define MOCK_MAX_TASK_CALLS_PER_FRAME (4 * RGB_MATRIX_LED_COUNT + 16)
+
+mock_led_t mock_leds[RGB_MATRIX_LED_COUNT];
+
+static uint32_t flush_count = 0;
+static uint32_t write_count = 0;
+static bool     shutdown    = false;
+static uint32_t shutdowns   = 0;
+
+static void mock_init(void) {}
+
+static void mock_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    write_count++;
+    mock_leds[index].r = r;
+    mock_leds[index].g = g;
+    mock_leds[index].b = b;
+}
+
+static void mock_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        mock_set_color(i, r, g, b);
+    }
+}
+
+static void mock_flush(void) {
+    flush_count++;
+}
+
+static void mock_shutdown(void) {
+    shutdown = true;
+    shutdowns++;
+}
+
+static void mock_exit_shutdown(void) {
+    shutdown = false;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = mock_init,
+    .set_color     = mock_set_color,
+    .set_color_all = mock_set_color_all,
+    .flush         = mock_flush,
+    .shutdown      = mock_shutdown,
+    .exit_shutdown = mock_exit_shutdown,
+};
+
+uint32_t mock_rgb_matrix_task_until_flush(void) {
+    uint32_t flushes = flush_count;
+    for (uint32_t calls = 1; calls <= MOCK_MAX_TASK_CALLS_PER_FRAME; calls++) {
+        rgb_matrix_task();
+        if (flush_count != flushes) {
+            return calls;
+        }
+    }
+    return 0;
+}
+
+uint32_t mock_rgb_matrix_render_frame(void) {
+    advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+    return mock_rgb_matrix_task_until_flush();
+}
+
+uint32_t mock_rgb_matrix_flush_count(void) {
+    return flush_count;
+}
+
+uint32_t mock_rgb_matrix_write_count(void) {
+    return write_count;
+}
+
+bool mock_rgb_matrix_is_shutdown(void) {
+    return shutdown;
+}
+
+uint32_t mock_rgb_matrix_shutdown_count(void) {
+    return shutdowns;
+}
+
+led_config_t g_led_config;
+
+void mock_rgb_matrix_reset(void) {
+    /* one LED per key, evenly spaced over the whole 224x64 area */
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t i                        = row * MATRIX_COLS + col;
+            g_led_config.matrix_co[row][col] = i;
+            g_led_config.point[i].x          = col * 224 / (MATRIX_COLS - 1);
+            g_led_config.point[i].y          = row * 64 / (MATRIX_ROWS - 1);
+            g_led_config.flags[i]            = LED_FLAG_KEYLIGHT;
+        }
+    }
+    memset(mock_leds, 0, sizeof(mock_leds));
+    flush_count = 0;
+    write_count = 0;
+    shutdowns   = 0;
+}
+
+bool eeconfig_is_enabled(void) {
+    return true;
+}
+
+void eeconfig_init(void) {}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+bool is_keyboard_left(void) {
+    return true;
+}
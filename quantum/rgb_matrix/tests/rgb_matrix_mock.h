@@ -0,0 +1,42 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} mock_led_t;
+
+/* colors written by the effects through rgb_matrix_set_color() */
+extern mock_led_t mock_leds[MATRIX_ROWS * MATRIX_COLS];
+
+/* lays out one LED per key and clears the mock driver */
+void mock_rgb_matrix_reset(void);
+
+/* runs rgb_matrix_task() until the next flush to the driver, returns the number of calls it took, or 0 if nothing was sent */
+uint32_t mock_rgb_matrix_task_until_flush(void);
+
+/* lets the flush limit pass, then runs the task until the next flush -- returns the same */
+uint32_t mock_rgb_matrix_render_frame(void);
+
+/* number of completed frames, counted by the driver flush */
+uint32_t mock_rgb_matrix_flush_count(void);
+
+/* number of LED colors written to the driver */
+uint32_t mock_rgb_matrix_write_count(void);
+
+/* whether the driver is shut down, and how many times it has been */
+bool     mock_rgb_matrix_is_shutdown(void);
+uint32_t mock_rgb_matrix_shutdown_count(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,174 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#define _Static_assert static_assert
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+#include "rgb_matrix_mock.h"
+
+HSV SPLASH_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+
+void set_time(uint32_t t);
+}
+
+/* The hit tracker as it used to be: a list ordered from oldest to newest, which drops the
+ * oldest hits when it is full, and a reverse search for the most recent hit of an LED. */
+class ReferenceHits {
+   public:
+    struct Hit {
+        uint8_t  led;
+        uint32_t time;
+    };
+
+    void press(uint8_t led, uint32_t time) {
+        if (hits_.size() == LED_HITS_TO_REMEMBER) {
+            hits_.erase(hits_.begin());
+        }
+        hits_.push_back({led, time});
+    }
+
+    const std::vector<Hit> &hits() const {
+        return hits_;
+    }
+
+    uint16_t led_tick(uint8_t led, uint32_t now) const {
+        for (auto hit = hits_.rbegin(); hit != hits_.rend(); ++hit) {
+            if (hit->led == led) {
+                return now - hit->time;
+            }
+        }
+        return UINT16_MAX;
+    }
+
+   private:
+    std::vector<Hit> hits_;
+};
+
+class RgbMatrixReactive : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        mock_rgb_matrix_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_set_speed_noeeprom(128);
+        mock_rgb_matrix_render_frame();
+    }
+
+    /* Presses a pseudo random key in both trackers, right after a frame so that the
+     * hit is aged from the same point in time by both */
+    void press_random_key() {
+        seed_       = seed_ * 1103515245 + 12345;
+        uint8_t row = (seed_ >> 16) % MATRIX_ROWS;
+        uint8_t col = (seed_ >> 8) % MATRIX_COLS;
+        process_rgb_matrix(row, col, true);
+        reference_.press(g_led_config.matrix_co[row][col], timer_read32());
+    }
+
+    /* Types for a number of frames, pressing a key every few of them */
+    template <typename F>
+    void type(int frames, int frames_per_key, F check) {
+        for (int frame = 0; frame < frames; frame++) {
+            if (frame % frames_per_key == 0) {
+                press_random_key();
+            }
+            mock_rgb_matrix_render_frame();
+            check();
+        }
+    }
+
+    void expect_same_hits() {
+        auto &hits = reference_.hits();
+        ASSERT_EQ(g_last_hit_tracker.count, hits.size());
+        for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+            uint8_t slot = last_hit_slot(&g_last_hit_tracker, j);
+            EXPECT_EQ(g_last_hit_tracker.index[slot], hits[j].led);
+            EXPECT_EQ(g_last_hit_tracker.x[slot], g_led_config.point[hits[j].led].x);
+            EXPECT_EQ(g_last_hit_tracker.y[slot], g_led_config.point[hits[j].led].y);
+            EXPECT_EQ(g_last_hit_tracker.tick[slot], (uint16_t)(g_rgb_timer - hits[j].time));
+        }
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            EXPECT_EQ(last_hit_led_tick(&g_last_hit_tracker, i), reference_.led_tick(i, g_rgb_timer)) << "led " << (int)i;
+        }
+    }
+
+    void expect_led(uint8_t i, HSV hsv) {
+        RGB rgb = hsv_to_rgb(hsv);
+        EXPECT_EQ(mock_leds[i].r, rgb.r) << "led " << (int)i;
+        EXPECT_EQ(mock_leds[i].g, rgb.g) << "led " << (int)i;
+        EXPECT_EQ(mock_leds[i].b, rgb.b) << "led " << (int)i;
+    }
+
+    uint32_t      seed_ = 0x5a5a;
+    ReferenceHits reference_;
+};
+
+TEST_F(RgbMatrixReactive, TracksSameHitsAsBefore) {
+    type(200, 3, [&] { expect_same_hits(); });
+}
+
+TEST_F(RgbMatrixReactive, TracksSameHitsWhenTypingFast) {
+    /* several keys per frame, so the ring buffer wraps around many times */
+    for (int frame = 0; frame < 200; frame++) {
+        for (int key = 0; key < 5; key++) {
+            press_random_key();
+        }
+        mock_rgb_matrix_render_frame();
+        expect_same_hits();
+    }
+}
+
+TEST_F(RgbMatrixReactive, ForgetsExpiredHits) {
+    press_random_key();
+    press_random_key();
+    mock_rgb_matrix_render_frame();
+    EXPECT_EQ(g_last_hit_tracker.count, 2);
+
+    for (int frame = 0; frame < UINT16_MAX / RGB_MATRIX_LED_FLUSH_LIMIT + 1; frame++) {
+        mock_rgb_matrix_render_frame();
+    }
+    EXPECT_EQ(g_last_hit_tracker.count, 0);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(last_hit_led_tick(&g_last_hit_tracker, i), UINT16_MAX);
+    }
+}
+
+TEST_F(RgbMatrixReactive, SolidReactiveSimpleLooksTheSame) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    type(300, 2, [&] {
+        uint16_t max_tick = 65535 / qadd8(rgb_matrix_config.speed, 1);
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            uint16_t tick = reference_.led_tick(i, g_rgb_timer);
+            if (tick > max_tick) {
+                tick = max_tick;
+            }
+            uint16_t offset = scale16by8(tick, qadd8(rgb_matrix_config.speed, 1));
+            expect_led(i, {0, 255, scale8(255 - offset, 255)});
+        }
+    });
+}
+
+TEST_F(RgbMatrixReactive, MultisplashLooksTheSame) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_MULTISPLASH);
+    type(300, 2, [&] {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            HSV hsv = {0, 255, 0};
+            for (auto &hit : reference_.hits()) {
+                int16_t  dx   = g_led_config.point[i].x - g_led_config.point[hit.led].x;
+                int16_t  dy   = g_led_config.point[i].y - g_led_config.point[hit.led].y;
+                uint8_t  dist = sqrt16(dx * dx + dy * dy);
+                uint16_t tick = scale16by8(g_rgb_timer - hit.time, qadd8(rgb_matrix_config.speed, 1));
+                hsv           = SPLASH_math(hsv, dx, dy, dist, tick);
+            }
+            hsv.v = scale8(hsv.v, 255);
+            expect_led(i, hsv);
+        }
+    });
+}
@@ -0,0 +1,130 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#define _Static_assert static_assert
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "effect_scheduler.h"
+#include "rgb_matrix_mock.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* renders frames at the given cost per LED, returns the process limit picked for the last one */
+static uint8_t run_frames(effect_scheduler_t *scheduler, uint32_t led_us, int frames) {
+    uint8_t limit = 0;
+    for (int frame = 0; frame < frames; frame++) {
+        limit = effect_scheduler_frame_start(scheduler);
+        for (uint16_t led = 0; led < scheduler->led_count; led += limit) {
+            uint8_t led_max = led + limit > scheduler->led_count ? scheduler->led_count : led + limit;
+            effect_scheduler_render_done(scheduler, led, led_max, (led_max - led) * led_us);
+        }
+        effect_scheduler_flush_done(scheduler, 100);
+    }
+    return limit;
+}
+
+TEST(EffectScheduler, StartsAtProcessLimit) {
+    effect_scheduler_t scheduler;
+    effect_scheduler_init(&scheduler, 250, 60, 12);
+    EXPECT_EQ(effect_scheduler_frame_start(&scheduler), 12);
+
+    effect_scheduler_init(&scheduler, 250, 60, 0);
+    EXPECT_EQ(effect_scheduler_frame_start(&scheduler), 60);
+}
+
+TEST(EffectScheduler, ConvergesToBudget) {
+    effect_scheduler_t scheduler;
+    effect_scheduler_init(&scheduler, 250, 100, 20);
+    EXPECT_EQ(run_frames(&scheduler, 10, 50), 25);
+    EXPECT_NEAR(scheduler.slice_us, 250, 10);
+
+    // the effect becomes cheaper, so more LEDs fit in a slice
+    EXPECT_EQ(run_frames(&scheduler, 5, 50), 50);
+}
+
+TEST(EffectScheduler, ClampsToLedCount) {
+    effect_scheduler_t scheduler;
+    effect_scheduler_init(&scheduler, 250, 40, 8);
+    EXPECT_EQ(run_frames(&scheduler, 0, 50), 40);
+}
+
+TEST(EffectScheduler, RendersAtLeastOneLed) {
+    effect_scheduler_t scheduler;
+    effect_scheduler_init(&scheduler, 250, 40, 8);
+    EXPECT_EQ(run_frames(&scheduler, 1000, 50), 1);
+}
+
+TEST(EffectScheduler, IgnoresEmptySlices) {
+    effect_scheduler_t scheduler;
+    effect_scheduler_init(&scheduler, 250, 40, 10);
+    for (int i = 0; i < 20; i++) {
+        effect_scheduler_render_done(&scheduler, 20, 20, 5000);
+    }
+    EXPECT_EQ(effect_scheduler_frame_start(&scheduler), 10);
+    EXPECT_EQ(scheduler.slice_max_us, 5000);
+}
+
+TEST(EffectScheduler, CountsFramesPerSecond) {
+    effect_scheduler_t scheduler;
+    set_time(0);
+    effect_scheduler_init(&scheduler, 250, 40, 10);
+    for (int frame = 0; frame < 70; frame++) {
+        advance_time(16);
+        effect_scheduler_flush_done(&scheduler, 300);
+    }
+    EXPECT_EQ(scheduler.fps, 62);
+    EXPECT_EQ(scheduler.flush_max_us, 300);
+
+    effect_scheduler_print(&scheduler, "test");
+    EXPECT_EQ(scheduler.slice_max_us, 0);
+    EXPECT_EQ(scheduler.flush_max_us, 0);
+}
+
+class RgbMatrixScheduler : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        mock_rgb_matrix_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        // a still image, so that frames can be compared
+        rgb_matrix_set_speed_noeeprom(0);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+    }
+};
+
+TEST_F(RgbMatrixScheduler, FastEffectsRenderInOneSlice) {
+    // the simulated timer only moves when the test advances it, so the effects take no time at all
+    for (int frame = 0; frame < 20; frame++) {
+        mock_rgb_matrix_render_frame();
+    }
+    EXPECT_EQ(rgb_matrix_get_scheduler()->process_limit, RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrixScheduler, SlicedFrameMatchesFullFrame) {
+    for (int frame = 0; frame < 20; frame++) {
+        mock_rgb_matrix_render_frame();
+    }
+    mock_led_t full[RGB_MATRIX_LED_COUNT];
+    memcpy(full, mock_leds, sizeof(full));
+
+    // pretend that rendering is slow, so that the next frame is split into slices of 3 LEDs
+    rgb_matrix_get_scheduler()->led_cost = (RGB_MATRIX_SCHEDULER_BUDGET_US << 4) / 3;
+    memset(mock_leds, 0, sizeof(mock_leds));
+    int calls = mock_rgb_matrix_render_frame();
+    EXPECT_EQ(rgb_matrix_get_scheduler()->process_limit, 3);
+    EXPECT_GE(calls, (RGB_MATRIX_LED_COUNT + 2) / 3);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(mock_leds[i].r, full[i].r) << "led " << (int)i;
+        EXPECT_EQ(mock_leds[i].g, full[i].g) << "led " << (int)i;
+        EXPECT_EQ(mock_leds[i].b, full[i].b) << "led " << (int)i;
+    }
+}
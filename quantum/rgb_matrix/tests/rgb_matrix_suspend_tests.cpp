@@ -0,0 +1,91 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#define _Static_assert static_assert
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+}
+
+class RgbMatrixSuspend : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // time only moves forward here, as the timeout counts the time between task calls
+        mock_rgb_matrix_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+        // wake up from whatever the previous test left behind
+        rgb_matrix_set_suspend_state(false);
+        process_rgb_matrix(0, 0, true);
+        mock_rgb_matrix_render_frame();
+    }
+
+    /* Lets the timeout expire with the task running */
+    void time_out() {
+        for (int elapsed = 0; elapsed <= RGB_MATRIX_TIMEOUT; elapsed += RGB_MATRIX_LED_FLUSH_LIMIT) {
+            mock_rgb_matrix_render_frame();
+        }
+        mock_rgb_matrix_render_frame();
+    }
+
+    bool all_off() {
+        for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            if (mock_leds[i].r || mock_leds[i].g || mock_leds[i].b) return false;
+        }
+        return true;
+    }
+};
+
+TEST_F(RgbMatrixSuspend, RunsUntilTimeout) {
+    EXPECT_FALSE(mock_rgb_matrix_is_shutdown());
+    EXPECT_TRUE(mock_rgb_matrix_render_frame());
+    EXPECT_FALSE(all_off());
+}
+
+TEST_F(RgbMatrixSuspend, TimeoutShutsDownDriver) {
+    time_out();
+    EXPECT_TRUE(mock_rgb_matrix_is_shutdown());
+    EXPECT_EQ(mock_rgb_matrix_shutdown_count(), 1);
+    EXPECT_TRUE(all_off());
+}
+
+TEST_F(RgbMatrixSuspend, NothingIsSentWhileShutDown) {
+    time_out();
+    uint32_t writes = mock_rgb_matrix_write_count();
+    for (int frame = 0; frame < 100; frame++) {
+        EXPECT_FALSE(mock_rgb_matrix_render_frame());
+    }
+    EXPECT_EQ(mock_rgb_matrix_write_count(), writes);
+    EXPECT_EQ(mock_rgb_matrix_shutdown_count(), 1);
+}
+
+TEST_F(RgbMatrixSuspend, KeypressWakesDriver) {
+    time_out();
+    process_rgb_matrix(0, 0, true);
+
+    // the next frame is drawn right away, without waiting for the flush limit
+    EXPECT_TRUE(mock_rgb_matrix_task_until_flush());
+    EXPECT_FALSE(mock_rgb_matrix_is_shutdown());
+    EXPECT_FALSE(all_off());
+}
+
+TEST_F(RgbMatrixSuspend, SuspendShutsDownDriver) {
+    rgb_matrix_set_suspend_state(true);
+    EXPECT_TRUE(mock_rgb_matrix_is_shutdown());
+    EXPECT_TRUE(all_off());
+
+    // the timeout expiring while suspended does not shut the driver down again
+    time_out();
+    EXPECT_EQ(mock_rgb_matrix_shutdown_count(), 1);
+
+    rgb_matrix_set_suspend_state(false);
+    process_rgb_matrix(0, 0, true);
+    EXPECT_TRUE(mock_rgb_matrix_render_frame());
+    EXPECT_FALSE(mock_rgb_matrix_is_shutdown());
+    EXPECT_FALSE(all_off());
+}
@@ -0,0 +1,152 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#define _Static_assert static_assert
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+
+void set_time(uint32_t t);
+
+/* stands in for the tables that qmk generate-keyboard-c writes from info.json */
+uint16_t       g_typing_heatmap_neighbor_index[MATRIX_ROWS * MATRIX_COLS + 1];
+led_neighbor_t g_typing_heatmap_neighbors[MATRIX_ROWS * MATRIX_COLS * MATRIX_ROWS * MATRIX_COLS];
+}
+
+// Defaults of typing_heatmap_anim.h
+static const int spread        = 40;
+static const int area_limit    = 16;
+static const int increase_step = 32;
+
+static int led_distance(uint8_t a, uint8_t b) {
+    int dx = g_led_config.point[a].x - g_led_config.point[b].x;
+    int dy = g_led_config.point[a].y - g_led_config.point[b].y;
+    return (int)std::sqrt((double)(dx * dx + dy * dy));
+}
+
+/* same as _gen_typing_heatmap_neighbors() in keyboard_c.py */
+static void generate_neighbors(void) {
+    uint16_t count = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            g_typing_heatmap_neighbor_index[row * MATRIX_COLS + col] = count;
+            uint16_t first = count;
+            for (uint8_t n_row = 0; n_row < MATRIX_ROWS; n_row++) {
+                for (uint8_t n_col = 0; n_col < MATRIX_COLS; n_col++) {
+                    if (n_row == row && n_col == col) continue;
+                    int distance = led_distance(g_led_config.matrix_co[row][col], g_led_config.matrix_co[n_row][n_col]);
+                    if (distance < spread) {
+                        g_typing_heatmap_neighbors[count++] = {n_row, n_col, (uint8_t)distance};
+                    }
+                }
+            }
+            std::stable_sort(g_typing_heatmap_neighbors + first, g_typing_heatmap_neighbors + count, [](const led_neighbor_t &a, const led_neighbor_t &b) { return a.distance < b.distance; });
+        }
+    }
+    g_typing_heatmap_neighbor_index[MATRIX_ROWS * MATRIX_COLS] = count;
+}
+
+/* drops the furthest neighbor of a key from the table */
+static void remove_last_neighbor(uint8_t row, uint8_t col) {
+    uint16_t key   = row * MATRIX_COLS + col;
+    uint16_t count = g_typing_heatmap_neighbor_index[MATRIX_ROWS * MATRIX_COLS];
+    uint16_t last  = g_typing_heatmap_neighbor_index[key + 1] - 1;
+    memmove(&g_typing_heatmap_neighbors[last], &g_typing_heatmap_neighbors[last + 1], (count - last - 1) * sizeof(led_neighbor_t));
+    for (uint16_t i = key + 1; i <= MATRIX_ROWS * MATRIX_COLS; i++) {
+        g_typing_heatmap_neighbor_index[i]--;
+    }
+}
+
+/* the heat a keypress adds to each key, computed over the whole matrix */
+static void expected_heat(uint8_t row, uint8_t col, uint8_t heat[MATRIX_ROWS][MATRIX_COLS]) {
+    memset(heat, 0, MATRIX_ROWS * MATRIX_COLS);
+    for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+        for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+            if (i_row == row && i_col == col) {
+                heat[i_row][i_col] = increase_step;
+                continue;
+            }
+            int distance = led_distance(g_led_config.matrix_co[row][col], g_led_config.matrix_co[i_row][i_col]);
+            if (distance <= spread) {
+                heat[i_row][i_col] = std::min(spread - distance, area_limit);
+            }
+        }
+    }
+}
+
+class RgbMatrixTypingHeatmap : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        mock_rgb_matrix_reset();
+        generate_neighbors();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        mock_rgb_matrix_render_frame();
+    }
+
+    /* (re)starts the effect, which picks up the neighbors */
+    void start_effect() {
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+        mock_rgb_matrix_render_frame();
+        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+    }
+
+    void expect_press(uint8_t row, uint8_t col) {
+        uint8_t heat[MATRIX_ROWS][MATRIX_COLS];
+        expected_heat(row, col, heat);
+        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        process_rgb_matrix(row, col, true);
+        for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+            for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+                EXPECT_EQ(g_rgb_frame_buffer[i_row][i_col], heat[i_row][i_col]) << "press " << (int)row << "," << (int)col << " at " << (int)i_row << "," << (int)i_col;
+            }
+        }
+    }
+};
+
+TEST_F(RgbMatrixTypingHeatmap, NeighborsSpreadLikeFullScan) {
+    start_effect();
+    expect_press(0, 0);
+    expect_press(2, 7);
+    expect_press(MATRIX_ROWS - 1, MATRIX_COLS - 1);
+}
+
+TEST_F(RgbMatrixTypingHeatmap, WrongNeighborsAreNotUsed) {
+    // a wrong distance in the table would spread heat to the wrong keys, unless it is rejected
+    g_typing_heatmap_neighbors[g_typing_heatmap_neighbor_index[2 * MATRIX_COLS + 7]].distance += 20;
+    start_effect();
+    expect_press(2, 7);
+}
+
+TEST_F(RgbMatrixTypingHeatmap, IncompleteNeighborsAreNotUsed) {
+    // a key missing from the table would get no heat, unless it is rejected
+    remove_last_neighbor(2, 7);
+    start_effect();
+    expect_press(2, 7);
+}
+
+TEST_F(RgbMatrixTypingHeatmap, ChangedLayoutFallsBackToFullScan) {
+    // move a key after the neighbors have been generated
+    g_led_config.point[g_led_config.matrix_co[2][8]].x += 6;
+    start_effect();
+    expect_press(2, 7);
+    expect_press(2, 8);
+}
+
+TEST_F(RgbMatrixTypingHeatmap, RepeatedPressesSaturate) {
+    start_effect();
+    for (int i = 0; i < 20; i++) {
+        process_rgb_matrix(3, 3, true);
+    }
+    EXPECT_EQ(g_rgb_frame_buffer[3][3], 255);
+    EXPECT_EQ(g_rgb_frame_buffer[3][4], 255);
+}
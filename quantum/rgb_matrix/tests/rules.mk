@@ -0,0 +1,73 @@
+rgb_matrix_effects_DEFS := -DNO_PRINT -DEEPROM_TEST_HARNESS
+rgb_matrix_effects_CONFIG := $(QUANTUM_PATH)/rgb_matrix/tests/config_mock.h
+rgb_matrix_effects_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners \
+	$(QUANTUM_PATH)/rgb_matrix/tests
+rgb_matrix_effects_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_mock.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_color_tests.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_effects_tests.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_reactive_tests.cpp
+
+rgb_matrix_effects_geometry_DEFS := $(rgb_matrix_effects_DEFS) -DRGB_MATRIX_LED_GEOMETRY -DRGB_MATRIX_FAST_HSV_BATCH
+rgb_matrix_effects_geometry_CONFIG := $(rgb_matrix_effects_CONFIG)
+rgb_matrix_effects_geometry_INC := $(rgb_matrix_effects_INC)
+rgb_matrix_effects_geometry_SRC := $(rgb_matrix_effects_SRC)
+
+rgb_matrix_effects_unspecialized_DEFS := $(rgb_matrix_effects_DEFS) -DRGB_MATRIX_EFFECT_SPECIALIZATION=0
+rgb_matrix_effects_unspecialized_CONFIG := $(rgb_matrix_effects_CONFIG)
+rgb_matrix_effects_unspecialized_INC := $(rgb_matrix_effects_INC)
+rgb_matrix_effects_unspecialized_SRC := $(rgb_matrix_effects_SRC)
+
+rgb_matrix_effects_scheduler_DEFS := $(rgb_matrix_effects_DEFS) -DRGB_MATRIX_SCHEDULER_BUDGET_US=250
+rgb_matrix_effects_scheduler_CONFIG := $(rgb_matrix_effects_CONFIG)
+rgb_matrix_effects_scheduler_INC := $(rgb_matrix_effects_INC)
+rgb_matrix_effects_scheduler_SRC := \
+	$(rgb_matrix_effects_SRC) \
+	$(QUANTUM_PATH)/logging/debug.c \
+	$(QUANTUM_PATH)/effect_scheduler.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_scheduler_tests.cpp
+
+rgb_matrix_compositor_DEFS := $(rgb_matrix_effects_DEFS) -DRGB_MATRIX_COMPOSITOR
+rgb_matrix_compositor_CONFIG := $(rgb_matrix_effects_CONFIG)
+rgb_matrix_compositor_INC := $(rgb_matrix_effects_INC)
+rgb_matrix_compositor_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_compositor.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_mock.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_compositor_tests.cpp
+
+rgb_matrix_suspend_DEFS := $(rgb_matrix_effects_DEFS) -DRGB_MATRIX_TIMEOUT=1000 -DRGB_DISABLE_WHEN_USB_SUSPENDED
+rgb_matrix_suspend_CONFIG := $(rgb_matrix_effects_CONFIG)
+rgb_matrix_suspend_INC := $(rgb_matrix_effects_INC)
+rgb_matrix_suspend_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_mock.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_suspend_tests.cpp
+
+rgb_matrix_typing_heatmap_DEFS := $(rgb_matrix_effects_DEFS) -DRGB_MATRIX_FRAMEBUFFER_EFFECTS -DENABLE_RGB_MATRIX_TYPING_HEATMAP
+rgb_matrix_typing_heatmap_CONFIG := $(rgb_matrix_effects_CONFIG)
+rgb_matrix_typing_heatmap_INC := $(rgb_matrix_effects_INC)
+rgb_matrix_typing_heatmap_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_mock.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_typing_heatmap_tests.cpp
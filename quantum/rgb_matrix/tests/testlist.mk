@@ -0,0 +1 @@
+TEST_LIST += rgb_matrix_effects rgb_matrix_effects_geometry rgb_matrix_effects_unspecialized rgb_matrix_effects_scheduler rgb_matrix_compositor rgb_matrix_suspend rgb_matrix_typing_heatmap
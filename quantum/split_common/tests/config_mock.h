@@ -0,0 +1,24 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 8
+
+#define SPLIT_KEYBOARD
+#define SPLIT_TRANSPORT_MIRROR
+#define SPLIT_LAYER_STATE_ENABLE
+#define SPLIT_LED_STATE_ENABLE
+#define SPLIT_MODS_ENABLE
+#define SPLIT_WPM_ENABLE
+#define WPM_ENABLE
+#define DISABLE_SYNC_TIMER
+
+#define ENCODER_ENABLE
+#define ENCODERS_PAD_A \
+    { 0, 2 }
+#define ENCODERS_PAD_B \
+    { 1, 3 }
+
+#include <stdint.h>
+typedef uint8_t pin_t;
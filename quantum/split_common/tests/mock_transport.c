@@ -0,0 +1,125 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "mock_transport.h"
+#include "transport.h"
+#include "transactions.h"
+#include "split_util.h"
+#include "action_layer.h"
+#include "serial.h"
+#include "wait.h"
+
+_Static_assert(NUM_ENCODERS_MAX_PER_SIDE == MOCK_NUM_ENCODERS, "Mismatching encoder count");
+
+static mock_transport_stats_t stats;
+static bool                   lose_responses;
+static bool                   fail_transactions;
+static uint32_t               latency_ms;
+
+uint8_t mock_master_mods;
+uint8_t mock_master_leds;
+uint8_t mock_master_wpm;
+uint8_t mock_master_encoders[MOCK_NUM_ENCODERS];
+uint8_t mock_slave_mods;
+uint8_t mock_slave_leds;
+uint8_t mock_slave_wpm;
+uint8_t mock_slave_encoders[MOCK_NUM_ENCODERS];
+
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+
+void mock_transport_reset(void) {
+    memset(&stats, 0, sizeof(stats));
+    lose_responses    = false;
+    fail_transactions = false;
+    latency_ms        = 0;
+}
+
+mock_transport_stats_t mock_transport_stats(void) {
+    return stats;
+}
+
+void mock_transport_lose_responses(bool lose) {
+    lose_responses = lose;
+}
+
+void mock_transport_fail_transactions(bool fail) {
+    fail_transactions = fail;
+}
+
+void mock_transport_set_latency(uint32_t ms) {
+    latency_ms = ms;
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int index) {
+    split_transaction_desc_t *trans = &split_transaction_table[index];
+
+    // every transaction starts with the id handshake, then the payload in each direction
+    stats.transactions++;
+    stats.bytes += 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+    wait_ms(latency_ms);
+
+    if (fail_transactions) {
+        return false;
+    }
+
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+
+    return !lose_responses;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+uint8_t get_mods(void) {
+    return mock_master_mods;
+}
+
+uint8_t get_weak_mods(void) {
+    return 0;
+}
+
+uint8_t get_oneshot_mods(void) {
+    return 0;
+}
+
+void set_mods(uint8_t mods) {
+    mock_slave_mods = mods;
+}
+
+void set_weak_mods(uint8_t mods) {}
+
+void set_oneshot_mods(uint8_t mods) {}
+
+uint8_t host_keyboard_leds(void) {
+    return mock_master_leds;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {
+    mock_slave_leds = led_state;
+}
+
+uint8_t get_current_wpm(void) {
+    return mock_master_wpm;
+}
+
+void set_current_wpm(uint8_t wpm) {
+    mock_slave_wpm = wpm;
+}
+
+void encoder_state_raw(uint8_t *slave_state) {
+    memcpy(slave_state, mock_slave_encoders, sizeof(mock_slave_encoders));
+}
+
+void encoder_update_raw(uint8_t *slave_state) {
+    memcpy(mock_master_encoders, slave_state, sizeof(mock_master_encoders));
+}
@@ -0,0 +1,44 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;
+} mock_transport_stats_t;
+
+/* Loopback serial transport: the master and slave halves share split_shmem, and slave
+ * callbacks run in between the two directions of a transaction, as on the wire. */
+void                   mock_transport_reset(void);
+mock_transport_stats_t mock_transport_stats(void);
+/* fail transactions after the slave has processed them */
+void mock_transport_lose_responses(bool lose);
+/* fail transactions before they reach the slave */
+void mock_transport_fail_transactions(bool fail);
+/* time taken by each transaction */
+void mock_transport_set_latency(uint32_t ms);
+
+#define MOCK_NUM_ENCODERS 2
+
+/* state observed by the master half */
+extern uint8_t mock_master_mods;
+extern uint8_t mock_master_leds;
+extern uint8_t mock_master_wpm;
+extern uint8_t mock_master_encoders[MOCK_NUM_ENCODERS];
+
+/* state applied on the slave half */
+extern uint8_t mock_slave_mods;
+extern uint8_t mock_slave_leds;
+extern uint8_t mock_slave_wpm;
+extern uint8_t mock_slave_encoders[MOCK_NUM_ENCODERS];
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,26 @@
+split_transactions_DEFS := -DNO_PRINT
+split_transactions_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+split_transactions_INC := $(QUANTUM_PATH)/split_common
+split_transactions_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/tests/mock_transport.c \
+	$(QUANTUM_PATH)/split_common/tests/transactions_tests.cpp
+
+split_transactions_state_frame_DEFS := $(split_transactions_DEFS) -DSPLIT_TRANSPORT_STATE_FRAME
+split_transactions_state_frame_CONFIG := $(split_transactions_CONFIG)
+split_transactions_state_frame_INC := $(split_transactions_INC)
+split_transactions_state_frame_SRC := $(split_transactions_SRC)
+
+split_transport_stats_DEFS := $(split_transactions_DEFS) -DSPLIT_TRANSPORT_STATS
+split_transport_stats_CONFIG := $(split_transactions_CONFIG)
+split_transport_stats_INC := $(split_transactions_INC)
+split_transport_stats_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/tests/mock_transport.c \
+	$(QUANTUM_PATH)/split_common/tests/transport_stats_tests.cpp
@@ -0,0 +1,196 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <iomanip>
+#include <iostream>
+
+extern "C" {
+#include "matrix.h"
+#include "mock_transport.h"
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+extern uint32_t layer_state;
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define ROWS_PER_HAND ((MATRIX_ROWS) / 2)
+#define FORCED_SYNC_THROTTLE_MS 100
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        mock_transport_reset();
+        // let both halves settle, including the initial full refresh
+        scan(FORCED_SYNC_THROTTLE_MS);
+        mock_transport_reset();
+    }
+
+    void TearDown() override {
+        memset(slave_matrix_, 0, sizeof(slave_matrix_));
+        memset(master_matrix_, 0, sizeof(master_matrix_));
+        memset(mock_slave_encoders, 0, sizeof(mock_slave_encoders));
+        mock_master_mods = 0;
+        mock_master_leds = 0;
+        mock_master_wpm  = 0;
+        layer_state      = 0;
+        scan(2);
+    }
+
+    /* One scan on both halves, the slave preparing its data before the master polls it */
+    void scan(uint32_t count = 1) {
+        for (uint32_t i = 0; i < count; i++) {
+            transactions_slave(mirrored_matrix_, slave_matrix_);
+            ok_ = transactions_master(master_matrix_, received_matrix_);
+            transactions_slave(mirrored_matrix_, slave_matrix_);
+            advance_time(1);
+        }
+    }
+
+    matrix_row_t slave_matrix_[ROWS_PER_HAND]    = {0};
+    matrix_row_t received_matrix_[ROWS_PER_HAND] = {0};
+    matrix_row_t master_matrix_[ROWS_PER_HAND]   = {0};
+    matrix_row_t mirrored_matrix_[ROWS_PER_HAND] = {0};
+    bool         ok_                             = false;
+};
+
+TEST_F(SplitTransactions, SlaveMatrixReachesMaster) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        slave_matrix_[row] = 1 << row;
+        scan();
+        EXPECT_TRUE(ok_);
+        EXPECT_EQ(memcmp(received_matrix_, slave_matrix_, sizeof(slave_matrix_)), 0) << "row " << (int)row;
+    }
+}
+
+TEST_F(SplitTransactions, MasterMatrixIsMirrored) {
+    master_matrix_[3] = 0x81;
+    scan();
+    EXPECT_EQ(mirrored_matrix_[3], 0x81);
+    master_matrix_[3] = 0;
+    scan();
+    EXPECT_EQ(mirrored_matrix_[3], 0);
+}
+
+TEST_F(SplitTransactions, MasterStateReachesSlave) {
+    mock_master_mods = 0x12;
+    mock_master_leds = 0x02;
+    mock_master_wpm  = 87;
+    scan();
+    EXPECT_TRUE(ok_);
+    EXPECT_EQ(mock_slave_mods, 0x12);
+    EXPECT_EQ(mock_slave_leds, 0x02);
+    EXPECT_EQ(mock_slave_wpm, 87);
+}
+
+TEST_F(SplitTransactions, EncodersReachMaster) {
+    mock_slave_encoders[1] = 3;
+    scan();
+    EXPECT_EQ(mock_master_encoders[1], 3);
+}
+
+TEST_F(SplitTransactions, RevertAfterLostResponseIsSent) {
+    // The slave may take the new mods, but the master never learns that it did
+    mock_master_mods = 0x01;
+    mock_transport_lose_responses(true);
+    scan();
+    EXPECT_FALSE(ok_);
+#ifdef SPLIT_TRANSPORT_STATE_FRAME
+    EXPECT_EQ(mock_slave_mods, 0x01);
+#endif
+
+    mock_master_mods = 0;
+    mock_transport_lose_responses(false);
+    scan();
+    EXPECT_TRUE(ok_);
+    EXPECT_EQ(mock_slave_mods, 0);
+}
+
+TEST_F(SplitTransactions, LostResponseKeepsLastMatrix) {
+    slave_matrix_[1] = 0x10;
+    scan();
+    slave_matrix_[1] = 0x30;
+    mock_transport_lose_responses(true);
+    scan();
+    EXPECT_FALSE(ok_);
+    EXPECT_EQ(received_matrix_[1], 0x10);
+    mock_transport_lose_responses(false);
+    scan();
+    EXPECT_TRUE(ok_);
+    EXPECT_EQ(received_matrix_[1], 0x30);
+}
+
+#ifdef SPLIT_TRANSPORT_STATE_FRAME
+TEST_F(SplitTransactions, FrameSizeFollowsChanges) {
+    // SetUp leaves both halves due for their periodic full refresh
+    scan();
+    mock_transport_stats_t full = mock_transport_stats();
+    mock_transport_reset();
+
+    scan();
+    mock_transport_stats_t idle = mock_transport_stats();
+    EXPECT_EQ(idle.transactions, 1);
+    EXPECT_LT(idle.bytes, full.bytes);
+    mock_transport_reset();
+
+    // master changes go out with the frame itself
+    master_matrix_[2] = 0x04;
+    scan();
+    mock_transport_stats_t master_change = mock_transport_stats();
+    EXPECT_EQ(master_change.transactions, 1);
+    EXPECT_GT(master_change.bytes, idle.bytes);
+    EXPECT_LT(master_change.bytes, full.bytes);
+    mock_transport_reset();
+
+    // slave changes are fetched with a second transaction
+    slave_matrix_[2] = 0x04;
+    scan();
+    mock_transport_stats_t slave_change = mock_transport_stats();
+    EXPECT_EQ(slave_change.transactions, 2);
+    EXPECT_LT(slave_change.bytes, full.bytes);
+    EXPECT_EQ(received_matrix_[2], 0x04);
+}
+#endif
+
+TEST_F(SplitTransactions, Benchmark) {
+    /* A key press or release on either half every 25 scans, with a mods change
+     * every 100 scans and the WPM moving every 500 scans. */
+    static const int SCANS = 10000;
+    uint32_t         seed  = 0x1234;
+    for (int i = 0; i < SCANS; i++) {
+        if (i % 25 == 0) {
+            seed = seed * 1103515245 + 12345;
+            if (seed & 0x10000) {
+                slave_matrix_[(seed >> 8) % ROWS_PER_HAND] ^= 1 << ((seed >> 4) % MATRIX_COLS);
+            } else {
+                master_matrix_[(seed >> 8) % ROWS_PER_HAND] ^= 1 << ((seed >> 4) % MATRIX_COLS);
+            }
+        }
+        if (i % 100 == 0) {
+            mock_master_mods ^= 0x02;
+        }
+        if (i % 500 == 0) {
+            mock_master_wpm++;
+        }
+        scan();
+        ASSERT_TRUE(ok_);
+    }
+    EXPECT_EQ(memcmp(received_matrix_, slave_matrix_, sizeof(slave_matrix_)), 0);
+    EXPECT_EQ(memcmp(mirrored_matrix_, master_matrix_, sizeof(master_matrix_)), 0);
+
+    mock_transport_stats_t stats = mock_transport_stats();
+#ifdef SPLIT_TRANSPORT_STATE_FRAME
+    const char *mode = "state frame";
+    // only scans picking up slave changes or a full refresh take a second transaction
+    EXPECT_LT(stats.transactions, SCANS + SCANS / 20);
+#else
+    const char *mode = "legacy";
+#endif
+    std::cout << "[ SPLIT    ] " << std::left << std::setw(12) << mode << std::right << std::fixed << std::setprecision(2) << " transactions per scan " << std::setw(5) << (double)stats.transactions / SCANS << "  bytes per scan " << std::setw(6) << (double)stats.bytes / SCANS << std::endl;
+}
@@ -0,0 +1,106 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#define _Static_assert static_assert
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#include "transactions.h"
+#include "mock_transport.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define ROWS_PER_HAND ((MATRIX_ROWS) / 2)
+
+class SplitTransportStats : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        mock_transport_reset();
+        scan(200);
+        split_transport_stats_reset();
+    }
+
+    void TearDown() override {
+        mock_transport_reset();
+    }
+
+    void scan(uint32_t count = 1) {
+        for (uint32_t i = 0; i < count; i++) {
+            transactions_slave(mirrored_matrix_, slave_matrix_);
+            transactions_master(master_matrix_, received_matrix_);
+            advance_time(1);
+        }
+    }
+
+    matrix_row_t slave_matrix_[ROWS_PER_HAND]    = {0};
+    matrix_row_t received_matrix_[ROWS_PER_HAND] = {0};
+    matrix_row_t master_matrix_[ROWS_PER_HAND]   = {0};
+    matrix_row_t mirrored_matrix_[ROWS_PER_HAND] = {0};
+};
+
+TEST_F(SplitTransportStats, CountsTransactionsAndBytes) {
+    scan(50);
+    const split_transaction_stats_t *stats = split_transport_stats_get(GET_SLAVE_MATRIX_CHECKSUM);
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(stats->count, 50);
+    EXPECT_EQ(stats->failures, 0);
+    EXPECT_EQ(stats->bytes, 50 * sizeof(uint8_t));
+    EXPECT_EQ(stats->histogram[0], 50);
+    EXPECT_EQ(split_transport_stats_elapsed(), 50);
+}
+
+TEST_F(SplitTransportStats, CountsWritesOnlyWhenSent) {
+    const split_transaction_stats_t *stats = split_transport_stats_get(PUT_MASTER_MATRIX);
+    scan(10);
+    uint32_t count = stats->count;
+    uint32_t bytes = stats->bytes;
+
+    master_matrix_[0] = 1;
+    scan();
+    EXPECT_EQ(stats->count, count + 1);
+    EXPECT_EQ(stats->bytes, bytes + sizeof(matrix_row_t) * ROWS_PER_HAND);
+}
+
+TEST_F(SplitTransportStats, CountsFailuresAndRetries) {
+    mock_transport_fail_transactions(true);
+    scan();
+    mock_transport_fail_transactions(false);
+
+    // the master retries a failing transaction 10 times per scan
+    const split_transaction_stats_t *stats = split_transport_stats_get(GET_SLAVE_MATRIX_CHECKSUM);
+    EXPECT_EQ(stats->count, 10);
+    EXPECT_EQ(stats->failures, 10);
+    EXPECT_EQ(stats->bytes, 0);
+}
+
+TEST_F(SplitTransportStats, RecordsLatency) {
+    mock_transport_set_latency(1);
+    scan(3);
+    mock_transport_set_latency(3);
+    scan();
+
+    const split_transaction_stats_t *stats = split_transport_stats_get(GET_SLAVE_MATRIX_CHECKSUM);
+    EXPECT_EQ(stats->total_us, 6000);
+    EXPECT_EQ(stats->max_us, 3000);
+    // 1000us lands in [512, 1024), 3000us in [2048, 4096)
+    EXPECT_EQ(stats->histogram[5], 3);
+    EXPECT_EQ(stats->histogram[SPLIT_TRANSPORT_STATS_BUCKETS - 1], 1);
+}
+
+TEST_F(SplitTransportStats, Reset) {
+    scan(5);
+    split_transport_stats_reset();
+    EXPECT_EQ(split_transport_stats_get(GET_SLAVE_MATRIX_CHECKSUM)->count, 0);
+    EXPECT_EQ(split_transport_stats_elapsed(), 0);
+}
+
+TEST_F(SplitTransportStats, InvalidId) {
+    EXPECT_EQ(split_transport_stats_get(NUM_TOTAL_TRANSACTIONS), nullptr);
+    // A raw HID byte must not wrap around to a negative index
+    EXPECT_EQ(split_transport_stats_get(0x80), nullptr);
+    EXPECT_EQ(split_transport_stats_get(0xFF), nullptr);
+}
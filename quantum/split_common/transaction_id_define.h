@@ -21,34 +21,45 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_STATE_FRAME
+    // one transaction per frame size, from no changed fields up to all of them
+    SYNC_STATE_FRAME_0,
+    SYNC_STATE_FRAME_1,
+    SYNC_STATE_FRAME_2,
+    SYNC_STATE_FRAME_3,
+    GET_STATE_FRAME_DATA_1,
+    GET_STATE_FRAME_DATA_2,
+    GET_STATE_FRAME_DATA_3,
+#else // SPLIT_TRANSPORT_STATE_FRAME
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
+#endif // SPLIT_TRANSPORT_STATE_FRAME
 
-#ifdef SPLIT_TRANSPORT_MIRROR
+#if defined(SPLIT_TRANSPORT_MIRROR) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
     PUT_MASTER_MATRIX,
-#endif // SPLIT_TRANSPORT_MIRROR
+#endif // defined(SPLIT_TRANSPORT_MIRROR) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
-#ifdef ENCODER_ENABLE
+#if defined(ENCODER_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
     GET_ENCODERS_CHECKSUM,
     GET_ENCODERS_DATA,
-#endif // ENCODER_ENABLE
+#endif // defined(ENCODER_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #ifndef DISABLE_SYNC_TIMER
     PUT_SYNC_TIMER,
 #endif // DISABLE_SYNC_TIMER
 
-#if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
     PUT_LAYER_STATE,
     PUT_DEFAULT_LAYER_STATE,
-#endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
-#ifdef SPLIT_LED_STATE_ENABLE
+#if defined(SPLIT_LED_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
     PUT_LED_STATE,
-#endif // SPLIT_LED_STATE_ENABLE
+#endif // defined(SPLIT_LED_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
-#ifdef SPLIT_MODS_ENABLE
+#if defined(SPLIT_MODS_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
     PUT_MODS,
-#endif // SPLIT_MODS_ENABLE
+#endif // defined(SPLIT_MODS_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #ifdef BACKLIGHT_ENABLE
     PUT_BACKLIGHT,
@@ -66,9 +77,9 @@ enum serial_transaction_id {
     PUT_RGB_MATRIX,
 #endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
-#if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
     PUT_WPM,
-#endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
     PUT_OLED,
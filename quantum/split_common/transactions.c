@@ -29,6 +29,7 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "util.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -170,9 +171,408 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// State frame
+
+#ifdef SPLIT_TRANSPORT_STATE_FRAME
+
+/* Replaces the individual matrix, encoder, layer, mods, LED state and WPM transactions with a
+ * single transaction per scan. Each side only sends the fields of its state that differ from
+ * what the other side has acknowledged, plus whatever was sent since but not acknowledged yet.
+ * The values themselves are absolute, so resending a field is always safe.
+ *
+ * The transports always move the whole buffer registered for a transaction, so frames go out
+ * through the transaction with the smallest buffer the changed fields fit in. The master sends
+ * its frame and gets back the header and bitmap of the slave frame in one transaction, and only
+ * fetches the slave's changed fields with a second one if there are any. */
+
+#    define SPLIT_STATE_FRAME_FULL (1 << 0)         // frame carries every field
+#    define SPLIT_STATE_FRAME_REQUEST_FULL (1 << 1) // sender wants a full frame in reply
+
+// Number of frame sizes, each with its own transaction in transaction_id_define.h
+#    define STATE_FRAME_SIZE_CLASSES 4
+// Bytes of changed fields held by frame size n, evenly spaced from none up to the whole state
+#    define state_frame_class_size(state_size, n) ((((state_size) * (n)) + STATE_FRAME_SIZE_CLASSES - 2) / (STATE_FRAME_SIZE_CLASSES - 1))
+#    define state_frame_bitmap_size(num_fields) (((num_fields) + 7) / 8)
+
+typedef struct {
+    uint8_t offset;
+    uint8_t size;
+} state_frame_field_t;
+
+// Field n of a state is matrix row n, or entry (n - rows) of fields once the rows run out
+typedef struct {
+    uint8_t                    rows_offset;
+    uint8_t                    rows;
+    uint8_t                    num_fields;
+    uint8_t                    bitmap_size;
+    const state_frame_field_t *fields;
+} state_frame_layout_t;
+
+typedef struct {
+    const state_frame_layout_t *layout;
+    uint8_t                     size;
+    uint8_t                    *acked; // state last acknowledged by the other side
+    uint8_t                    *sent;  // state at the time of the last frame
+    uint8_t                     seq;
+    uint32_t                    pending; // fields sent since the last acknowledged frame
+} state_frame_sender_t;
+
+#    define state_frame_field(type, member) \
+        { offsetof(type, member), sizeof_member(type, member) }
+#    define state_frame_checksum(frame, length) crc8(((uint8_t *)(frame)) + sizeof((frame)->header.checksum), (length) - sizeof((frame)->header.checksum))
+
+static const state_frame_field_t state_m2s_fields[] = {
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    state_frame_field(split_state_m2s_t, layer_state),
+    state_frame_field(split_state_m2s_t, default_layer_state),
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifdef SPLIT_MODS_ENABLE
+    state_frame_field(split_state_m2s_t, mods),
+#    endif // SPLIT_MODS_ENABLE
+#    ifdef SPLIT_LED_STATE_ENABLE
+    state_frame_field(split_state_m2s_t, led_state),
+#    endif // SPLIT_LED_STATE_ENABLE
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    state_frame_field(split_state_m2s_t, current_wpm),
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+};
+
+static const state_frame_field_t state_s2m_fields[] = {
+#    ifdef ENCODER_ENABLE
+    state_frame_field(split_state_s2m_t, encoders),
+#    endif // ENCODER_ENABLE
+};
+
+#    ifdef SPLIT_TRANSPORT_MIRROR
+#        define STATE_M2S_ROWS ((MATRIX_ROWS) / 2)
+#    else // SPLIT_TRANSPORT_MIRROR
+#        define STATE_M2S_ROWS 0
+#    endif // SPLIT_TRANSPORT_MIRROR
+#    define STATE_S2M_ROWS ((MATRIX_ROWS) / 2)
+#    define STATE_M2S_BITMAP_SIZE state_frame_bitmap_size(STATE_M2S_ROWS + ARRAY_SIZE(state_m2s_fields))
+#    define STATE_S2M_BITMAP_SIZE state_frame_bitmap_size(STATE_S2M_ROWS + ARRAY_SIZE(state_s2m_fields))
+
+static const state_frame_layout_t state_m2s_layout = {
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    .rows_offset = offsetof(split_state_m2s_t, matrix),
+#    endif // SPLIT_TRANSPORT_MIRROR
+    .rows        = STATE_M2S_ROWS,
+    .num_fields  = ARRAY_SIZE(state_m2s_fields),
+    .bitmap_size = STATE_M2S_BITMAP_SIZE,
+    .fields      = state_m2s_fields,
+};
+
+static const state_frame_layout_t state_s2m_layout = {
+    .rows_offset = offsetof(split_state_s2m_t, matrix),
+    .rows        = STATE_S2M_ROWS,
+    .num_fields  = ARRAY_SIZE(state_s2m_fields),
+    .bitmap_size = STATE_S2M_BITMAP_SIZE,
+    .fields      = state_s2m_fields,
+};
+
+_Static_assert(STATE_M2S_ROWS + ARRAY_SIZE(state_m2s_fields) <= 32, "Too many fields for the state frame change bitmap");
+_Static_assert(STATE_S2M_ROWS + ARRAY_SIZE(state_s2m_fields) <= 32, "Too many fields for the state frame change bitmap");
+_Static_assert(sizeof(split_state_frame_m2s_t) <= UINT8_MAX && sizeof(split_state_frame_s2m_t) <= UINT8_MAX, "State frame too large for a single transaction");
+_Static_assert(GET_STATE_FRAME_DATA_1 - SYNC_STATE_FRAME_0 == STATE_FRAME_SIZE_CLASSES, "Mismatching number of state frame transactions");
+
+static split_state_m2s_t    state_m2s_acked;
+static split_state_m2s_t    state_m2s_sent;
+static state_frame_sender_t state_m2s_sender = {.layout = &state_m2s_layout, .size = sizeof(split_state_m2s_t), .acked = (uint8_t *)&state_m2s_acked, .sent = (uint8_t *)&state_m2s_sent};
+static split_state_s2m_t    state_s2m_acked;
+static split_state_s2m_t    state_s2m_sent;
+static state_frame_sender_t state_s2m_sender = {.layout = &state_s2m_layout, .size = sizeof(split_state_s2m_t), .acked = (uint8_t *)&state_s2m_acked, .sent = (uint8_t *)&state_s2m_sent};
+
+static inline uint8_t state_frame_num_fields(const state_frame_layout_t *layout) {
+    return layout->rows + layout->num_fields;
+}
+
+static inline void state_frame_field_at(const state_frame_layout_t *layout, uint8_t index, uint8_t *offset, uint8_t *size) {
+    if (index < layout->rows) {
+        *offset = layout->rows_offset + index * sizeof(matrix_row_t);
+        *size   = sizeof(matrix_row_t);
+    } else {
+        *offset = layout->fields[index - layout->rows].offset;
+        *size   = layout->fields[index - layout->rows].size;
+    }
+}
+
+static inline uint32_t state_frame_all_fields(const state_frame_layout_t *layout) {
+    uint8_t num_fields = state_frame_num_fields(layout);
+    return num_fields < 32 ? ((uint32_t)1 << num_fields) - 1 : UINT32_MAX;
+}
+
+// Total size of the fields set in changed, as packed into a frame
+static uint8_t state_frame_size(const state_frame_layout_t *layout, uint32_t changed) {
+    uint8_t total = 0;
+    uint8_t offset, size;
+    for (uint8_t i = 0; i < state_frame_num_fields(layout); i++) {
+        if (changed & ((uint32_t)1 << i)) {
+            state_frame_field_at(layout, i, &offset, &size);
+            total += size;
+        }
+    }
+    return total;
+}
+
+// Smallest frame size holding size bytes of changed fields
+static uint8_t state_frame_size_class(uint8_t state_size, uint8_t size) {
+    uint8_t n = 0;
+    while (state_frame_class_size(state_size, n) < size) {
+        n++;
+    }
+    return n;
+}
+
+static void state_frame_write_bitmap(const state_frame_layout_t *layout, uint32_t changed, uint8_t *data) {
+    for (uint8_t i = 0; i < layout->bitmap_size; i++) {
+        data[i] = changed >> (i * 8);
+    }
+}
+
+static uint32_t state_frame_read_bitmap(const state_frame_layout_t *layout, const uint8_t *data) {
+    uint32_t changed = 0;
+    for (uint8_t i = 0; i < layout->bitmap_size; i++) {
+        changed |= (uint32_t)data[i] << (i * 8);
+    }
+    // Drop bits past the last field, so that a corrupted bitmap never describes more than the state
+    return changed & state_frame_all_fields(layout);
+}
+
+static uint32_t state_frame_diff(const state_frame_layout_t *layout, const uint8_t *state, const uint8_t *baseline) {
+    uint32_t changed = 0;
+    uint8_t  offset, size;
+    for (uint8_t i = 0; i < state_frame_num_fields(layout); i++) {
+        state_frame_field_at(layout, i, &offset, &size);
+        if (memcmp(state + offset, baseline + offset, size) != 0) {
+            changed |= (uint32_t)1 << i;
+        }
+    }
+    return changed;
+}
+
+static void state_frame_pack(const state_frame_layout_t *layout, uint32_t changed, const uint8_t *state, uint8_t *data) {
+    uint8_t offset, size;
+    for (uint8_t i = 0; i < state_frame_num_fields(layout); i++) {
+        if (changed & ((uint32_t)1 << i)) {
+            state_frame_field_at(layout, i, &offset, &size);
+            memcpy(data, state + offset, size);
+            data += size;
+        }
+    }
+}
+
+static void state_frame_unpack(const state_frame_layout_t *layout, uint32_t changed, const uint8_t *data, uint8_t *state) {
+    uint8_t offset, size;
+    for (uint8_t i = 0; i < state_frame_num_fields(layout); i++) {
+        if (changed & ((uint32_t)1 << i)) {
+            state_frame_field_at(layout, i, &offset, &size);
+            memcpy(state + offset, data, size);
+            data += size;
+        }
+    }
+}
+
+static void state_frame_acknowledge(state_frame_sender_t *sender, uint8_t ack) {
+    // Every frame includes all pending fields, so acknowledging the latest one covers them all
+    if (ack == sender->seq) {
+        memcpy(sender->acked, sender->sent, sender->size);
+        sender->pending = 0;
+    }
+}
+
+// Fills in the frame, returning the size of the changed fields packed after the bitmap
+static uint8_t state_frame_build(state_frame_sender_t *sender, const void *state, split_state_frame_header_t *header, uint8_t *data, uint8_t ack, uint8_t flags) {
+    uint32_t changed;
+    if (flags & SPLIT_STATE_FRAME_FULL) {
+        changed = state_frame_all_fields(sender->layout);
+    } else {
+        changed = sender->pending | state_frame_diff(sender->layout, state, sender->acked);
+    }
+
+    state_frame_write_bitmap(sender->layout, changed, data);
+    state_frame_pack(sender->layout, changed, state, data + sender->layout->bitmap_size);
+    memcpy(sender->sent, state, sender->size);
+    sender->pending = changed;
+
+    header->seq   = ++sender->seq;
+    header->ack   = ack;
+    header->flags = flags;
+    return state_frame_size(sender->layout, changed);
+}
+
+static bool state_frame_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t          last_full_sync = 0;
+    static bool              synced         = false;
+    static bool              full_requested = false;
+    static uint8_t           slave_seq      = 0;
+    static split_state_s2m_t slave_state    = {0};
+
+    split_state_m2s_t state;
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    memcpy(state.matrix, master_matrix, sizeof(state.matrix));
+#    endif // SPLIT_TRANSPORT_MIRROR
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    state.layer_state         = layer_state;
+    state.default_layer_state = default_layer_state;
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifdef SPLIT_MODS_ENABLE
+    state.mods.real_mods = get_mods();
+    state.mods.weak_mods = get_weak_mods();
+#        ifndef NO_ACTION_ONESHOT
+    state.mods.oneshot_mods = get_oneshot_mods();
+#        endif // NO_ACTION_ONESHOT
+#    endif     // SPLIT_MODS_ENABLE
+#    ifdef SPLIT_LED_STATE_ENABLE
+    state.led_state = host_keyboard_leds();
+#    endif // SPLIT_LED_STATE_ENABLE
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    state.current_wpm = get_current_wpm();
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+
+    // Both halves are periodically refreshed in full, in case the slave was reset
+    uint8_t flags = 0;
+    if (!synced || timer_elapsed32(last_full_sync) >= FORCED_SYNC_THROTTLE_MS) {
+        flags |= SPLIT_STATE_FRAME_FULL | SPLIT_STATE_FRAME_REQUEST_FULL;
+    } else if (full_requested) {
+        flags |= SPLIT_STATE_FRAME_FULL;
+    }
+
+    split_state_frame_m2s_t m2s        = {0};
+    split_state_frame_s2m_t s2m        = {0};
+    uint8_t                 m2s_class  = state_frame_size_class(sizeof(split_state_m2s_t), state_frame_build(&state_m2s_sender, &state, &m2s.header, m2s.data, slave_seq, flags));
+    uint8_t                 m2s_length = offsetof(split_state_frame_m2s_t, data) + STATE_M2S_BITMAP_SIZE + state_frame_class_size(sizeof(split_state_m2s_t), m2s_class);
+    m2s.header.checksum                = state_frame_checksum(&m2s, m2s_length);
+
+    bool     okay        = transport_execute_transaction(SYNC_STATE_FRAME_0 + m2s_class, &m2s, m2s_length, &s2m, offsetof(split_state_frame_s2m_t, data) + STATE_S2M_BITMAP_SIZE);
+    uint32_t s2m_changed = state_frame_read_bitmap(&state_s2m_layout, s2m.data);
+    uint8_t  s2m_size    = state_frame_size(&state_s2m_layout, s2m_changed);
+    if (okay && s2m_size > 0) {
+        uint8_t s2m_class = state_frame_size_class(sizeof(split_state_s2m_t), s2m_size);
+        okay              = transport_read(GET_STATE_FRAME_DATA_1 + s2m_class - 1, s2m.data + STATE_S2M_BITMAP_SIZE, state_frame_class_size(sizeof(split_state_s2m_t), s2m_class));
+    }
+    // A mismatching ack means the slave did not receive this frame intact
+    okay = okay && s2m.header.checksum == state_frame_checksum(&s2m, offsetof(split_state_frame_s2m_t, data) + STATE_S2M_BITMAP_SIZE + s2m_size) && s2m.header.ack == m2s.header.seq;
+    if (okay) {
+        state_frame_acknowledge(&state_m2s_sender, s2m.header.ack);
+        state_frame_unpack(&state_s2m_layout, s2m_changed, s2m.data + STATE_S2M_BITMAP_SIZE, (uint8_t *)&slave_state);
+        slave_seq      = s2m.header.seq;
+        full_requested = s2m.header.flags & SPLIT_STATE_FRAME_REQUEST_FULL;
+        if (flags & SPLIT_STATE_FRAME_REQUEST_FULL) {
+            synced         = true;
+            last_full_sync = timer_read32();
+        }
+#    ifdef ENCODER_ENABLE
+        encoder_update_raw(slave_state.encoders);
+#    endif // ENCODER_ENABLE
+    }
+
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, slave_state.matrix, sizeof(slave_state.matrix));
+    return okay;
+}
+
+static void state_frame_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_state_m2s_t state;
+
+    split_shared_memory_lock();
+    memcpy(split_shmem->state_s2m.matrix, slave_matrix, sizeof(split_shmem->state_s2m.matrix));
+#    ifdef ENCODER_ENABLE
+    encoder_state_raw(split_shmem->state_s2m.encoders);
+#    endif // ENCODER_ENABLE
+    memcpy(&state, &split_shmem->state_m2s, sizeof(state));
+    split_shared_memory_unlock();
+
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    memcpy(master_matrix, state.matrix, sizeof(state.matrix));
+#    endif // SPLIT_TRANSPORT_MIRROR
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    layer_state         = state.layer_state;
+    default_layer_state = state.default_layer_state;
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifdef SPLIT_MODS_ENABLE
+    set_mods(state.mods.real_mods);
+    set_weak_mods(state.mods.weak_mods);
+#        ifndef NO_ACTION_ONESHOT
+    set_oneshot_mods(state.mods.oneshot_mods);
+#        endif // NO_ACTION_ONESHOT
+#    endif     // SPLIT_MODS_ENABLE
+#    ifdef SPLIT_LED_STATE_ENABLE
+    void set_split_host_keyboard_leds(uint8_t led_state);
+    set_split_host_keyboard_leds(state.led_state);
+#    endif // SPLIT_LED_STATE_ENABLE
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    set_current_wpm(state.current_wpm);
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+}
+
+// Runs on the slave in between receiving the master frame and sending back its own
+static void slave_state_frame_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    static uint8_t master_seq = 0;
+    static bool    synced     = false;
+
+    split_state_frame_m2s_t *m2s         = &split_shmem->state_frame_m2s;
+    split_state_frame_s2m_t *s2m         = &split_shmem->state_frame_s2m;
+    uint32_t                 m2s_changed = state_frame_read_bitmap(&state_m2s_layout, m2s->data);
+    uint8_t                  flags       = 0;
+
+    // The frame only covers the buffer of the transaction it was sent with
+    bool m2s_fits = offsetof(split_state_frame_m2s_t, data) + STATE_M2S_BITMAP_SIZE + state_frame_size(&state_m2s_layout, m2s_changed) <= initiator2target_buffer_size;
+    if (m2s_fits && m2s->header.checksum == state_frame_checksum(m2s, initiator2target_buffer_size)) {
+        state_frame_unpack(&state_m2s_layout, m2s_changed, m2s->data + STATE_M2S_BITMAP_SIZE, (uint8_t *)&split_shmem->state_m2s);
+        state_frame_acknowledge(&state_s2m_sender, m2s->header.ack);
+        master_seq = m2s->header.seq;
+        if (m2s->header.flags & SPLIT_STATE_FRAME_FULL) {
+            synced = true;
+        }
+        if (m2s->header.flags & SPLIT_STATE_FRAME_REQUEST_FULL) {
+            flags |= SPLIT_STATE_FRAME_FULL;
+        }
+    }
+    if (!synced) {
+        flags |= SPLIT_STATE_FRAME_REQUEST_FULL;
+    }
+
+    uint8_t s2m_size     = state_frame_build(&state_s2m_sender, &split_shmem->state_s2m, &s2m->header, s2m->data, master_seq, flags);
+    s2m->header.checksum = state_frame_checksum(s2m, offsetof(split_state_frame_s2m_t, data) + STATE_S2M_BITMAP_SIZE + s2m_size);
+}
+
+// clang-format off
+#    define TRANSACTIONS_STATE_FRAME_MASTER() TRANSACTION_HANDLER_MASTER(state_frame)
+#    define TRANSACTIONS_STATE_FRAME_SLAVE() TRANSACTION_HANDLER_SLAVE(state_frame)
+#    define state_frame_sync_initializer(n) { \
+        offsetof(split_state_frame_m2s_t, data) + STATE_M2S_BITMAP_SIZE + state_frame_class_size(sizeof(split_state_m2s_t), n), offsetof(split_shared_memory_t, state_frame_m2s), \
+        offsetof(split_state_frame_s2m_t, data) + STATE_S2M_BITMAP_SIZE, offsetof(split_shared_memory_t, state_frame_s2m), \
+        slave_state_frame_callback \
+    }
+#    define state_frame_data_initializer(n) { \
+        0, 0, \
+        state_frame_class_size(sizeof(split_state_s2m_t), n), offsetof(split_shared_memory_t, state_frame_s2m) + offsetof(split_state_frame_s2m_t, data) + STATE_S2M_BITMAP_SIZE, \
+        NULL \
+    }
+#    define TRANSACTIONS_STATE_FRAME_REGISTRATIONS \
+    [SYNC_STATE_FRAME_0] = state_frame_sync_initializer(0), \
+    [SYNC_STATE_FRAME_1] = state_frame_sync_initializer(1), \
+    [SYNC_STATE_FRAME_2] = state_frame_sync_initializer(2), \
+    [SYNC_STATE_FRAME_3] = state_frame_sync_initializer(3), \
+    [GET_STATE_FRAME_DATA_1] = state_frame_data_initializer(1), \
+    [GET_STATE_FRAME_DATA_2] = state_frame_data_initializer(2), \
+    [GET_STATE_FRAME_DATA_3] = state_frame_data_initializer(3),
+// clang-format on
+
+#else // SPLIT_TRANSPORT_STATE_FRAME
+
+#    define TRANSACTIONS_STATE_FRAME_MASTER()
+#    define TRANSACTIONS_STATE_FRAME_SLAVE()
+#    define TRANSACTIONS_STATE_FRAME_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_STATE_FRAME
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifndef SPLIT_TRANSPORT_STATE_FRAME
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -194,17 +594,25 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+#else // SPLIT_TRANSPORT_STATE_FRAME
+
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER()
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE()
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_STATE_FRAME
+
 ////////////////////////////////////////////////////
 // Master matrix
 
-#ifdef SPLIT_TRANSPORT_MIRROR
+#if defined(SPLIT_TRANSPORT_MIRROR) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 static bool master_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
@@ -220,18 +628,18 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 #    define TRANSACTIONS_MASTER_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(master_matrix)
 #    define TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS [PUT_MASTER_MATRIX] = trans_initiator2target_initializer(mmatrix.matrix),
 
-#else // SPLIT_TRANSPORT_MIRROR
+#else // defined(SPLIT_TRANSPORT_MIRROR) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #    define TRANSACTIONS_MASTER_MATRIX_MASTER()
 #    define TRANSACTIONS_MASTER_MATRIX_SLAVE()
 #    define TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
 
-#endif // SPLIT_TRANSPORT_MIRROR
+#endif // defined(SPLIT_TRANSPORT_MIRROR) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 ////////////////////////////////////////////////////
 // Encoders
 
-#ifdef ENCODER_ENABLE
+#if defined(ENCODER_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
@@ -259,13 +667,13 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
     [GET_ENCODERS_DATA]     = trans_target2initiator_initializer(encoders.state),
 // clang-format on
 
-#else // ENCODER_ENABLE
+#else // defined(ENCODER_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #    define TRANSACTIONS_ENCODERS_MASTER()
 #    define TRANSACTIONS_ENCODERS_SLAVE()
 #    define TRANSACTIONS_ENCODERS_REGISTRATIONS
 
-#endif // ENCODER_ENABLE
+#endif // defined(ENCODER_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 ////////////////////////////////////////////////////
 // Sync timer
@@ -309,7 +717,7 @@ static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 ////////////////////////////////////////////////////
 // Layer state
 
-#if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_layer_state_update         = 0;
@@ -335,18 +743,18 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
     [PUT_DEFAULT_LAYER_STATE] = trans_initiator2target_initializer(layers.default_layer_state),
 // clang-format on
 
-#else // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#else // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #    define TRANSACTIONS_LAYER_STATE_MASTER()
 #    define TRANSACTIONS_LAYER_STATE_SLAVE()
 #    define TRANSACTIONS_LAYER_STATE_REGISTRATIONS
 
-#endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 ////////////////////////////////////////////////////
 // LED state
 
-#ifdef SPLIT_LED_STATE_ENABLE
+#if defined(SPLIT_LED_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 static bool led_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
@@ -363,18 +771,18 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_LED_STATE_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(led_state)
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS [PUT_LED_STATE] = trans_initiator2target_initializer(led_state),
 
-#else // SPLIT_LED_STATE_ENABLE
+#else // defined(SPLIT_LED_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #    define TRANSACTIONS_LED_STATE_MASTER()
 #    define TRANSACTIONS_LED_STATE_SLAVE()
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS
 
-#endif // SPLIT_LED_STATE_ENABLE
+#endif // defined(SPLIT_LED_STATE_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 ////////////////////////////////////////////////////
 // Mods
 
-#ifdef SPLIT_MODS_ENABLE
+#if defined(SPLIT_MODS_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
@@ -425,13 +833,13 @@ static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #    define TRANSACTIONS_MODS_SLAVE() TRANSACTION_HANDLER_SLAVE(mods)
 #    define TRANSACTIONS_MODS_REGISTRATIONS [PUT_MODS] = trans_initiator2target_initializer(mods),
 
-#else // SPLIT_MODS_ENABLE
+#else // defined(SPLIT_MODS_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #    define TRANSACTIONS_MODS_MASTER()
 #    define TRANSACTIONS_MODS_SLAVE()
 #    define TRANSACTIONS_MODS_REGISTRATIONS
 
-#endif // SPLIT_MODS_ENABLE
+#endif // defined(SPLIT_MODS_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 ////////////////////////////////////////////////////
 // Backlight
@@ -577,7 +985,7 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 ////////////////////////////////////////////////////
 // WPM
 
-#if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 static bool wpm_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
@@ -593,13 +1001,13 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
 
-#else // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#else // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 #    define TRANSACTIONS_WPM_MASTER()
 #    define TRANSACTIONS_WPM_SLAVE()
 #    define TRANSACTIONS_WPM_REGISTRATIONS
 
-#endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSPORT_STATE_FRAME)
 
 ////////////////////////////////////////////////////
 // OLED
@@ -895,6 +1303,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_STATE_FRAME_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -925,6 +1334,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_STATE_FRAME_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -948,6 +1358,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
 }
 
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_STATE_FRAME_SLAVE();
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
     TRANSACTIONS_ENCODERS_SLAVE();
@@ -16,11 +16,14 @@
 
 #include <string.h>
 #include <debug.h>
+#include <print.h>
 
 #include "transactions.h"
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "atomic_util.h"
+#include "timer.h"
+#include "util.h"
 
 #ifdef USE_I2C
 
@@ -59,7 +62,7 @@ i2c_status_t transport_trigger_callback(int8_t id) {
     return i2c_writeReg(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     i2c_status_t              status;
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
@@ -100,7 +103,7 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
@@ -121,7 +124,108 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_STATS
+
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+typedef systime_t stats_timestamp_t;
+#        define stats_timestamp() chVTGetSystemTimeX()
+#        define stats_elapsed_us(start) ((uint32_t)TIME_I2US(chVTTimeElapsedSinceX(start)))
+#    else
+// No common microsecond timer, fall back to millisecond resolution
+typedef uint32_t stats_timestamp_t;
+#        define stats_timestamp() timer_read32()
+#        define stats_elapsed_us(start) (timer_elapsed32(start) * 1000)
+#    endif
+
+static split_transaction_stats_t transaction_stats[NUM_TOTAL_TRANSACTIONS];
+static uint32_t                  stats_since = 0;
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t  *trans = &split_transaction_table[id];
+    split_transaction_stats_t *stats = &transaction_stats[id];
+
+    stats_timestamp_t start   = stats_timestamp();
+    bool              okay    = transport_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    uint32_t          elapsed = stats_elapsed_us(start);
+
+    uint8_t bucket = 0;
+    while (bucket < SPLIT_TRANSPORT_STATS_BUCKETS - 1 && (elapsed >> (bucket + SPLIT_TRANSPORT_STATS_BUCKET_SHIFT)) != 0) {
+        bucket++;
+    }
+
+    stats->count++;
+    if (!okay) {
+        stats->failures++;
+    } else {
+        if (initiator2target_length > 0) {
+            stats->bytes += MIN(trans->initiator2target_buffer_size, initiator2target_length);
+        }
+        if (target2initiator_length > 0) {
+            stats->bytes += MIN(trans->target2initiator_buffer_size, target2initiator_length);
+        }
+    }
+    stats->total_us += elapsed;
+    stats->max_us = MAX(stats->max_us, elapsed);
+    if (stats->histogram[bucket] < UINT16_MAX) {
+        stats->histogram[bucket]++;
+    }
+
+    return okay;
+}
+
+const split_transaction_stats_t *split_transport_stats_get(uint8_t id) {
+    return id < NUM_TOTAL_TRANSACTIONS ? &transaction_stats[id] : NULL;
+}
+
+uint32_t split_transport_stats_elapsed(void) {
+    return timer_elapsed32(stats_since);
+}
+
+void split_transport_stats_reset(void) {
+    memset(transaction_stats, 0, sizeof(transaction_stats));
+    stats_since = timer_read32();
+}
+
+void split_transport_stats_print(void) {
+    uint32_t elapsed_ms = split_transport_stats_elapsed();
+    uint32_t busy_us    = 0;
+
+    uprintf("split transport stats over %lums\n", elapsed_ms);
+    uprintf(" id    count  fail    bytes   avg us   max us  histogram\n");
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_stats_t *stats = &transaction_stats[id];
+        if (stats->count == 0) {
+            continue;
+        }
+        busy_us += stats->total_us;
+        uprintf("%3d %8lu %5lu %8lu %8lu %8lu ", id, stats->count, stats->failures, stats->bytes, stats->total_us / stats->count, stats->max_us);
+        for (uint8_t bucket = 0; bucket < SPLIT_TRANSPORT_STATS_BUCKETS; bucket++) {
+            uprintf(" %u", stats->histogram[bucket]);
+        }
+        uprintf("\n");
+    }
+    if (elapsed_ms > 0) {
+        uprintf("link busy %lu.%lu%%\n", busy_us / (elapsed_ms * 10), (busy_us / elapsed_ms) % 10);
+    }
+}
+
+#else // SPLIT_TRANSPORT_STATS
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    return transport_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+}
+
+#endif // SPLIT_TRANSPORT_STATS
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#if defined(SPLIT_TRANSPORT_STATS) && SPLIT_TRANSPORT_STATS_INTERVAL > 0
+    static uint32_t last_print = 0;
+    if (debug_enable && timer_elapsed32(last_print) >= SPLIT_TRANSPORT_STATS_INTERVAL) {
+        last_print = timer_read32();
+        split_transport_stats_print();
+    }
+#endif // defined(SPLIT_TRANSPORT_STATS) && SPLIT_TRANSPORT_STATS_INTERVAL > 0
     return transactions_master(master_matrix, slave_matrix);
 }
 
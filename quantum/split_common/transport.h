@@ -40,6 +40,38 @@ void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+#ifdef SPLIT_TRANSPORT_STATS
+#    ifndef SPLIT_TRANSPORT_STATS_BUCKETS
+#        define SPLIT_TRANSPORT_STATS_BUCKETS 8
+#    endif // SPLIT_TRANSPORT_STATS_BUCKETS
+
+// Bucket 0 counts transactions under (1 << SPLIT_TRANSPORT_STATS_BUCKET_SHIFT) us, each further bucket doubles that
+#    ifndef SPLIT_TRANSPORT_STATS_BUCKET_SHIFT
+#        define SPLIT_TRANSPORT_STATS_BUCKET_SHIFT 5
+#    endif // SPLIT_TRANSPORT_STATS_BUCKET_SHIFT
+
+// Interval at which the stats are printed to the console while debug is enabled, 0 to disable
+#    ifndef SPLIT_TRANSPORT_STATS_INTERVAL
+#        define SPLIT_TRANSPORT_STATS_INTERVAL 10000
+#    endif // SPLIT_TRANSPORT_STATS_INTERVAL
+
+typedef struct _split_transaction_stats_t {
+    uint32_t count;
+    uint32_t failures;
+    uint32_t bytes;
+    uint32_t total_us;
+    uint32_t max_us;
+    uint16_t histogram[SPLIT_TRANSPORT_STATS_BUCKETS];
+} split_transaction_stats_t;
+
+// returns NULL for an invalid transaction id
+const split_transaction_stats_t *split_transport_stats_get(uint8_t id);
+// milliseconds since the stats were last reset
+uint32_t split_transport_stats_elapsed(void);
+void     split_transport_stats_reset(void);
+void     split_transport_stats_print(void);
+#endif // SPLIT_TRANSPORT_STATS
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -105,6 +137,54 @@ typedef struct _split_mods_sync_t {
 } split_mods_sync_t;
 #endif // SPLIT_MODS_ENABLE
 
+#ifdef SPLIT_TRANSPORT_STATE_FRAME
+// Master state replicated to the slave by the state frame transaction
+typedef struct _split_state_m2s_t {
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    matrix_row_t matrix[(MATRIX_ROWS) / 2];
+#    endif // SPLIT_TRANSPORT_MIRROR
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    layer_state_t layer_state;
+    layer_state_t default_layer_state;
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifdef SPLIT_MODS_ENABLE
+    split_mods_sync_t mods;
+#    endif // SPLIT_MODS_ENABLE
+#    ifdef SPLIT_LED_STATE_ENABLE
+    uint8_t led_state;
+#    endif // SPLIT_LED_STATE_ENABLE
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    uint8_t current_wpm;
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+} split_state_m2s_t;
+
+// Slave state replicated to the master by the state frame transaction
+typedef struct _split_state_s2m_t {
+    matrix_row_t matrix[(MATRIX_ROWS) / 2];
+#    ifdef ENCODER_ENABLE
+    uint8_t encoders[NUM_ENCODERS_MAX_PER_SIDE];
+#    endif // ENCODER_ENABLE
+} split_state_s2m_t;
+
+typedef struct _split_state_frame_header_t {
+    uint8_t checksum;
+    uint8_t seq;   // incremented for every frame sent
+    uint8_t ack;   // seq of the last valid frame received from the other half
+    uint8_t flags; // SPLIT_STATE_FRAME_FULL, SPLIT_STATE_FRAME_REQUEST_FULL
+} split_state_frame_header_t;
+
+// data starts with a bitmap of the state fields carried, matrix rows first, followed by those fields packed back to back
+typedef struct _split_state_frame_m2s_t {
+    split_state_frame_header_t header;
+    uint8_t                    data[sizeof(uint32_t) + sizeof(split_state_m2s_t)];
+} split_state_frame_m2s_t;
+
+typedef struct _split_state_frame_s2m_t {
+    split_state_frame_header_t header;
+    uint8_t                    data[sizeof(uint32_t) + sizeof(split_state_s2m_t)];
+} split_state_frame_s2m_t;
+#endif // SPLIT_TRANSPORT_STATE_FRAME
+
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
 typedef struct _split_slave_pointing_sync_t {
@@ -230,6 +310,13 @@ typedef struct _split_shared_memory_t {
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
     os_variant_t detected_os;
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+
+#ifdef SPLIT_TRANSPORT_STATE_FRAME
+    split_state_frame_m2s_t state_frame_m2s;
+    split_state_frame_s2m_t state_frame_s2m;
+    split_state_m2s_t       state_m2s; // slave copy of the master state, updated from received frames
+    split_state_s2m_t       state_s2m; // slave state to be sent with the next frame
+#endif // SPLIT_TRANSPORT_STATE_FRAME
 } split_shared_memory_t;
 
 extern split_shared_memory_t *const split_shmem;
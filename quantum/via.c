@@ -57,6 +57,11 @@
 #    include "led_matrix.h"
 #endif
 
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSPORT_STATS)
+#    include "transport.h"
+#    include "transaction_id_define.h"
+#endif
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
@@ -273,9 +278,68 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
 // Controlling custom features should be done by overriding
 // via_custom_value_command_kb() instead.
 __attribute__((weak)) bool via_command_kb(uint8_t *data, uint8_t length) {
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSPORT_STATS)
+    return via_split_transport_stats_command(data, length);
+#else
     return false;
+#endif
+}
+
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSPORT_STATS)
+static void via_put_uint32(uint8_t *data, uint32_t value) {
+    data[0] = (value >> 24) & 0xFF;
+    data[1] = (value >> 16) & 0xFF;
+    data[2] = (value >> 8) & 0xFF;
+    data[3] = value & 0xFF;
 }
 
+// Handles the split transport stats on the keyboard's custom channel, returns false if the
+// command is not for them. Keyboards overriding via_command_kb() can call this from there.
+bool via_split_transport_stats_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, transaction_id, page, value_data ]
+    uint8_t *command_id     = &(data[0]);
+    uint8_t *channel_id     = &(data[1]);
+    uint8_t *value_id       = &(data[2]);
+    uint8_t *transaction_id = &(data[3]);
+    uint8_t *page           = &(data[4]);
+    uint8_t *value_data     = &(data[5]);
+
+    if (*channel_id != id_custom_channel || *value_id != VIA_SPLIT_TRANSPORT_STATS_VALUE_ID) {
+        return false;
+    }
+
+    if (*command_id == id_custom_set_value) {
+        split_transport_stats_reset();
+    } else if (*command_id == id_custom_get_value) {
+        if (*transaction_id == 0xFF) {
+            value_data[0] = NUM_TOTAL_TRANSACTIONS;
+            via_put_uint32(&value_data[1], split_transport_stats_elapsed());
+        } else {
+            const split_transaction_stats_t *stats = split_transport_stats_get(*transaction_id);
+            if (stats == NULL) {
+                *command_id = id_unhandled;
+            } else if (*page == 0) {
+                via_put_uint32(&value_data[0], stats->count);
+                via_put_uint32(&value_data[4], stats->failures);
+                via_put_uint32(&value_data[8], stats->bytes);
+                via_put_uint32(&value_data[12], stats->total_us);
+                via_put_uint32(&value_data[16], stats->max_us);
+            } else {
+                for (uint8_t i = 0; i < SPLIT_TRANSPORT_STATS_BUCKETS && 5 + i * 2 + 1 < length; i++) {
+                    value_data[i * 2]     = stats->histogram[i] >> 8;
+                    value_data[i * 2 + 1] = stats->histogram[i] & 0xFF;
+                }
+            }
+        }
+    } else {
+        return false;
+    }
+
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
+
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
@@ -71,6 +71,12 @@
 #    define VIA_FIRMWARE_VERSION 0x00000000
 #endif
 
+// The value ID on the custom channel used for the split transport stats.
+// Define this in config.h to override it if it collides with the keyboard's own custom values.
+#ifndef VIA_SPLIT_TRANSPORT_STATS_VALUE_ID
+#    define VIA_SPLIT_TRANSPORT_STATS_VALUE_ID 0xF0
+#endif
+
 enum via_command_id {
     id_get_protocol_version                 = 0x01, // always 0x01
     id_get_keyboard_value                   = 0x02,
@@ -202,4 +208,8 @@ void via_qmk_audio_command(uint8_t *data, uint8_t length);
 void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
+#endif
+
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSPORT_STATS)
+bool via_split_transport_stats_command(uint8_t *data, uint8_t length);
 #endif
\ No newline at end of file
@@ -0,0 +1,11 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Runs the basic test suites again, with LAYER_LOOKUP_CACHE enabled.
+
+VPATH += tests/basic
+SRC += \
+	tests/basic/test_action_layer.cpp \
+	tests/basic/test_keypress.cpp \
+	tests/basic/test_one_shot_keys.cpp \
+	tests/basic/test_tapping.cpp
@@ -0,0 +1,113 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerLookupCache : public TestFixture {};
+
+TEST_F(LayerLookupCache, ResolvesThroughTransparentLayers) {
+    TestDriver driver;
+    KeymapKey  base  = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  trans = KeymapKey(1, 0, 0, KC_TRANSPARENT);
+    KeymapKey  top   = KeymapKey(2, 0, 0, KC_B);
+
+    set_keymap({base, trans, top});
+
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 2);
+    layer_off(2);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, DefaultLayerChange) {
+    TestDriver driver;
+    KeymapKey  base  = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  other = KeymapKey(3, 0, 0, KC_B);
+
+    set_keymap({base, other});
+
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+    default_layer_set((layer_state_t)1 << 3);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 3);
+    default_layer_set(0);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, LayerStateWrittenDirectly) {
+    TestDriver driver;
+    KeymapKey  base = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  top  = KeymapKey(1, 0, 0, KC_B);
+
+    set_keymap({base, top});
+
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+    layer_state = (layer_state_t)1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(base.position), 1);
+    layer_state = 0;
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, KeymapChangeClearsCache) {
+    TestDriver driver;
+    KeymapKey  base = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  top  = KeymapKey(1, 0, 0, KC_TRANSPARENT);
+
+    set_keymap({base, top});
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+
+    set_keymap({base, KeymapKey(1, 0, 0, KC_B)});
+    EXPECT_EQ(layer_switch_get_layer(base.position), 1);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, KeysResolveIndependently) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a     = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b     = KeymapKey(0, 1, 0, KC_B);
+    KeymapKey  layer_key = KeymapKey(0, 2, 0, MO(1));
+    KeymapKey  key_c     = KeymapKey(1, 1, 0, KC_C);
+
+    set_keymap({key_a, key_b, layer_key, key_c, KeymapKey(1, 0, 0, KC_TRANSPARENT)});
+
+    layer_key.press();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 1);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_REPORT(driver, (KC_A, KC_C));
+    key_b.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_C));
+    key_a.release();
+    run_one_scan_loop();
+    EXPECT_EMPTY_REPORT(driver);
+    key_b.release();
+    run_one_scan_loop();
+    layer_key.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
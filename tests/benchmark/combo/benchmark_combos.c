@@ -0,0 +1,11 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* Placeholder for keymap introspection, the benchmark overrides combo_count() and
+ * combo_get() with a generated combo table. */
+uint16_t const unused_combo[] = {KC_NO, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(unused_combo, KC_NO),
+};
@@ -0,0 +1,15 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Same benchmark as the parent directory, without COMBO_KEYCODE_INDEX.
+
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = benchmark_combos.c
+
+VPATH += tests/benchmark/combo
+SRC += tests/benchmark/combo/test_combo_benchmark.cpp
+
+LDFLAGS += -Wl,--wrap=process_combo
+
+include tests/test_common/latency_profiler.mk
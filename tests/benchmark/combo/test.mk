@@ -0,0 +1,10 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = benchmark_combos.c
+
+LDFLAGS += -Wl,--wrap=process_combo
+
+include tests/test_common/latency_profiler.mk
@@ -0,0 +1,123 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "latency_profiler.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "quantum.h"
+}
+
+using testing::_;
+using testing::NiceMock;
+
+#define SYNTHETIC_COMBO_COUNT 512
+#define COMBO_KEY_COUNT 30
+
+/* Keycodes on the first three rows are used by combos, the last row is not. */
+static uint16_t combo_keycode(uint8_t i) {
+    return i < 26 ? KC_A + i : KC_1 + (i - 26);
+}
+
+static uint16_t combo_keys[SYNTHETIC_COMBO_COUNT][4];
+static combo_t  synthetic_combos[SYNTHETIC_COMBO_COUNT];
+
+extern "C" {
+uint16_t combo_count(void) {
+    return SYNTHETIC_COMBO_COUNT;
+}
+
+combo_t* combo_get(uint16_t combo_idx) {
+    return &synthetic_combos[combo_idx];
+}
+
+bool __real_process_combo(uint16_t keycode, keyrecord_t* record);
+
+bool __wrap_process_combo(uint16_t keycode, keyrecord_t* record) {
+    auto start = LatencyProfiler::clock::now();
+    bool ret   = __real_process_combo(keycode, record);
+    auto end   = LatencyProfiler::clock::now();
+    LatencyProfiler::instance().add_sample("process_combo", std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    return ret;
+}
+}
+
+class ComboBenchmark : public LatencyBenchmark {
+   protected:
+    static void SetUpTestCase() {
+        /* All two key chords over the combo keys, then three key chords until the table is full. */
+        uint16_t count = 0;
+        for (uint8_t i = 0; i < COMBO_KEY_COUNT && count < SYNTHETIC_COMBO_COUNT; i++) {
+            for (uint8_t j = i + 1; j < COMBO_KEY_COUNT && count < SYNTHETIC_COMBO_COUNT; j++) {
+                combo_keys[count][0] = combo_keycode(i);
+                combo_keys[count][1] = combo_keycode(j);
+                combo_keys[count][2] = COMBO_END;
+                count++;
+            }
+        }
+        for (uint8_t i = 0; count < SYNTHETIC_COMBO_COUNT; i++) {
+            combo_keys[count][0] = combo_keycode(i % COMBO_KEY_COUNT);
+            combo_keys[count][1] = combo_keycode((i + 7) % COMBO_KEY_COUNT);
+            combo_keys[count][2] = combo_keycode((i + 13) % COMBO_KEY_COUNT);
+            combo_keys[count][3] = COMBO_END;
+            count++;
+        }
+        for (uint16_t i = 0; i < SYNTHETIC_COMBO_COUNT; i++) {
+            synthetic_combos[i] = (combo_t)COMBO(combo_keys[i], KC_ENTER);
+        }
+
+        TestFixture::SetUpTestCase();
+    }
+
+    void SetUp() override {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint8_t i = row * MATRIX_COLS + col;
+                add_key(KeymapKey(0, col, row, i < COMBO_KEY_COUNT ? combo_keycode(i) : KC_F1 + (i - COMBO_KEY_COUNT)));
+            }
+        }
+        LatencyBenchmark::SetUp();
+    }
+
+    KeymapKey key_at(uint8_t i) {
+        return *find_key(0, {.col = static_cast<uint8_t>(i % MATRIX_COLS), .row = static_cast<uint8_t>(i / MATRIX_COLS)});
+    }
+};
+
+TEST_F(ComboBenchmark, KeysOutsideCombos) {
+    NiceMock<TestDriver> driver;
+
+    for (int i = 0; i < 2000; i++) {
+        tap(key_at(COMBO_KEY_COUNT + i % (MATRIX_ROWS * MATRIX_COLS - COMBO_KEY_COUNT)), 20, 20);
+    }
+
+    report();
+    EXPECT_GT(LatencyProfiler::instance().samples("process_combo").size(), 0u);
+}
+
+TEST_F(ComboBenchmark, CombosAndCandidateKeys) {
+    NiceMock<TestDriver> driver;
+
+    uint32_t seed = 0x2468;
+    for (int i = 0; i < 1000; i++) {
+        seed        = seed * 1103515245 + 12345;
+        KeymapKey a = key_at((seed >> 16) % COMBO_KEY_COUNT);
+        KeymapKey b = key_at((((seed >> 16) % COMBO_KEY_COUNT) + 1 + (seed >> 8) % (COMBO_KEY_COUNT - 1)) % COMBO_KEY_COUNT);
+
+        /* A lone combo key, resolved once COMBO_TERM expires. */
+        tap(a, 20, COMBO_TERM + 10);
+
+        /* A two key chord. */
+        press_key(a.position.col, a.position.row);
+        press_key(b.position.col, b.position.row);
+        scan_for(COMBO_TERM + 10);
+        release_key(a.position.col, a.position.row);
+        release_key(b.position.col, b.position.row);
+        scan_for(20);
+    }
+
+    report();
+    EXPECT_GT(LatencyProfiler::instance().samples("process_combo").size(), 0u);
+}
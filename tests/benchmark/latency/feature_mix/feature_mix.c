@@ -0,0 +1,24 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "feature_mix.h"
+
+uint16_t const jk_combo[]  = {KC_J, KC_K, COMBO_END};
+uint16_t const df_combo[]  = {KC_D, KC_F, COMBO_END};
+uint16_t const sdf_combo[] = {KC_S, KC_D, KC_F, COMBO_END};
+uint16_t const io_combo[]  = {KC_I, KC_O, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(jk_combo, KC_ESC),
+    COMBO(df_combo, KC_TAB),
+    COMBO(sdf_combo, KC_ENT),
+    COMBO(io_combo, KC_BSPC),
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    [TD_ESC_CAPS]  = ACTION_TAP_DANCE_DOUBLE(KC_ESC, KC_CAPS),
+    [TD_SCLN_COLN] = ACTION_TAP_DANCE_DOUBLE(KC_SCLN, KC_COLN),
+};
+// clang-format on
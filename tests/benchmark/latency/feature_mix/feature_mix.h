@@ -0,0 +1,6 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+enum tap_dance_ids { TD_ESC_CAPS, TD_SCLN_COLN };
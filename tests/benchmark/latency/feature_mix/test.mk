@@ -0,0 +1,10 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+COMBO_ENABLE = yes
+TAP_DANCE_ENABLE = yes
+AUTO_SHIFT_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = feature_mix.c
+
+include tests/test_common/latency_profiler.mk
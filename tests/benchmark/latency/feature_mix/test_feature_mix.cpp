@@ -0,0 +1,79 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "latency_profiler.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "feature_mix.h"
+}
+
+using testing::_;
+using testing::NiceMock;
+
+class LatencyFeatureMix : public LatencyBenchmark {};
+
+TEST_F(LatencyFeatureMix, CombosTapDanceAutoShift) {
+    NiceMock<TestDriver> driver;
+
+    auto key_s    = KeymapKey(0, 0, 0, KC_S);
+    auto key_d    = KeymapKey(0, 1, 0, KC_D);
+    auto key_f    = KeymapKey(0, 2, 0, KC_F);
+    auto key_j    = KeymapKey(0, 3, 0, KC_J);
+    auto key_k    = KeymapKey(0, 4, 0, KC_K);
+    auto key_i    = KeymapKey(0, 5, 0, KC_I);
+    auto key_o    = KeymapKey(0, 6, 0, KC_O);
+    auto key_esc  = KeymapKey(0, 7, 0, TD(TD_ESC_CAPS));
+    auto key_scln = KeymapKey(0, 8, 0, TD(TD_SCLN_COLN));
+    auto key_mt   = KeymapKey(0, 9, 0, LSFT_T(KC_A));
+
+    set_keymap({key_s, key_d, key_f, key_j, key_k, key_i, key_o, key_esc, key_scln, key_mt});
+
+    std::vector<KeymapKey> letters = {key_s, key_d, key_f, key_j, key_k, key_i, key_o};
+
+    uint32_t seed = 0x5678;
+    for (int i = 0; i < 300; i++) {
+        seed = seed * 1103515245 + 12345;
+
+        /* Regular typing, auto-shifted when held past the auto shift timeout. */
+        for (int n = 0; n < 5; n++) {
+            seed = seed * 1103515245 + 12345;
+            tap(letters[(seed >> 16) % letters.size()], (seed & 0x100) ? AUTO_SHIFT_TIMEOUT + 20 : 30, 20);
+        }
+
+        /* Two and three key combos. */
+        press_key(key_j.position.col, key_j.position.row);
+        press_key(key_k.position.col, key_k.position.row);
+        scan_for(30);
+        release_key(key_j.position.col, key_j.position.row);
+        release_key(key_k.position.col, key_k.position.row);
+        scan_for(20);
+
+        press_key(key_s.position.col, key_s.position.row);
+        scan_for(5);
+        press_key(key_d.position.col, key_d.position.row);
+        press_key(key_f.position.col, key_f.position.row);
+        scan_for(30);
+        release_key(key_s.position.col, key_s.position.row);
+        release_key(key_d.position.col, key_d.position.row);
+        release_key(key_f.position.col, key_f.position.row);
+        scan_for(20);
+
+        /* Single and double tap dances. */
+        tap(key_esc, 20, TAPPING_TERM + 20);
+        tap(key_scln, 20, 40);
+        tap(key_scln, 20, TAPPING_TERM + 20);
+
+        /* Mod-tap interrupted by a letter. */
+        press_key(key_mt.position.col, key_mt.position.row);
+        scan_for(20);
+        tap(key_i, 20, 10);
+        release_key(key_mt.position.col, key_mt.position.row);
+        scan_for(TAPPING_TERM);
+    }
+
+    report();
+    EXPECT_GT(LatencyProfiler::instance().samples(LatencyStage::ScanToReport).size(), 0u);
+}
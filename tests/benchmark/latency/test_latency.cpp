@@ -0,0 +1,76 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "latency_profiler.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::NiceMock;
+
+class Latency : public LatencyBenchmark {};
+
+TEST_F(Latency, PlainTyping) {
+    NiceMock<TestDriver> driver;
+    std::vector<KeymapKey> keys;
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        keys.emplace_back(0, col, 0, KC_A + col);
+    }
+    for (auto& key : keys) {
+        add_key(key);
+    }
+
+    /* Deterministic pseudo-random typing, with varying hold and gap times. */
+    uint32_t seed = 0x1234;
+    for (int i = 0; i < 2000; i++) {
+        seed = seed * 1103515245 + 12345;
+        tap(keys[(seed >> 16) % keys.size()], 10 + (seed >> 8) % 40, 10 + (seed >> 4) % 30);
+    }
+
+    report();
+    EXPECT_GT(LatencyProfiler::instance().samples(LatencyStage::ScanToReport).size(), 0u);
+}
+
+TEST_F(Latency, RolloverWithModsAndLayers) {
+    NiceMock<TestDriver> driver;
+    auto key_shift = KeymapKey(0, 0, 1, KC_LSFT);
+    auto key_layer = KeymapKey(0, 1, 1, MO(1));
+    auto key_mt    = KeymapKey(0, 2, 1, LCTL_T(KC_SPC));
+    auto key_a     = KeymapKey(0, 3, 1, KC_A);
+    auto key_b     = KeymapKey(0, 4, 1, KC_B);
+    auto key_a_l1  = KeymapKey(1, 3, 1, KC_1);
+    auto key_b_l1  = KeymapKey(1, 4, 1, KC_TRNS);
+
+    set_keymap({key_shift, key_layer, key_mt, key_a, key_b, key_a_l1, key_b_l1});
+
+    for (int i = 0; i < 500; i++) {
+        /* Shifted roll: shift, a, b overlapping. */
+        press_key(key_shift.position.col, key_shift.position.row);
+        scan_for(15);
+        press_key(key_a.position.col, key_a.position.row);
+        scan_for(15);
+        press_key(key_b.position.col, key_b.position.row);
+        scan_for(15);
+        release_key(key_a.position.col, key_a.position.row);
+        scan_for(15);
+        release_key(key_b.position.col, key_b.position.row);
+        release_key(key_shift.position.col, key_shift.position.row);
+        scan_for(30);
+
+        /* Layer key with a transparent fall-through. */
+        press_key(key_layer.position.col, key_layer.position.row);
+        scan_for(15);
+        tap(key_a, 20, 10);
+        tap(key_b, 20, 10);
+        release_key(key_layer.position.col, key_layer.position.row);
+        scan_for(30);
+
+        /* Mod-tap, alternating tap and hold. */
+        tap(key_mt, (i & 1) ? 20 : TAPPING_TERM + 20, 30);
+    }
+
+    report();
+    EXPECT_GT(LatencyProfiler::instance().samples(LatencyStage::ProcessRecord).size(), 0u);
+}
@@ -0,0 +1,349 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "painter_benchmark.h"
+#include "qp_internal.h"
+#include "qp_comms_dummy.h"
+#include "qp_tft_panel.h"
+#include "qgf.h"
+#include "qff.h"
+
+// Clock of the simulated SPI bus between the MCU and the panel
+#ifndef PAINTER_BENCHMARK_SPI_HZ
+#    define PAINTER_BENCHMARK_SPI_HZ 40000000
+#endif
+
+// How many times slower the simulated MCU draws than the host, can be overridden with QMK_PAINTER_CPU_SCALE
+#ifndef PAINTER_BENCHMARK_CPU_SCALE
+#    define PAINTER_BENCHMARK_CPU_SCALE 25
+#endif
+
+#define NS_PER_BYTE (8ULL * 1000000000ULL / (PAINTER_BENCHMARK_SPI_HZ))
+
+extern const tft_panel_dc_reset_painter_driver_vtable_t st7789_driver_vtable;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Simulated bus
+//
+// The dummy comms driver sends nothing, so the time each transfer would take on the wire is added to a simulated
+// clock, next to the host time spent drawing in between. An asynchronous transfer only reads its data once the next
+// comms call waits for it to finish, so any pixel data overwritten while still in flight changes wire_hash.
+
+static struct {
+    uint64_t                  host_last; // host time at the end of the last comms call
+    uint64_t                  now;       // simulated time
+    uint64_t                  bus_free;  // simulated time at which the bus finishes the current transfer
+    uint32_t                  cpu_scale;
+    const uint8_t *           pending;
+    uint32_t                  pending_length;
+    painter_benchmark_stats_t stats;
+} bus;
+
+uint64_t painter_benchmark_host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint32_t fnv1a(uint32_t hash, const void *data, uint32_t length) {
+    const uint8_t *p = (const uint8_t *)data;
+    for (uint32_t i = 0; i < length; i++) {
+        hash = (hash ^ p[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+// Accounts for the drawing done since the last comms call, and waits for the bus
+static void bus_enter(void) {
+    uint64_t cpu_ns = (painter_benchmark_host_ns() - bus.host_last) * bus.cpu_scale;
+    bus.now += cpu_ns;
+    bus.stats.cpu_ns += cpu_ns;
+
+    if (bus.pending) {
+        bus.stats.wire_hash = fnv1a(bus.stats.wire_hash, bus.pending, bus.pending_length);
+        bus.pending         = NULL;
+    }
+    if (bus.now < bus.bus_free) {
+        bus.now = bus.bus_free;
+    }
+}
+
+static void bus_leave(void) {
+    bus.host_last = painter_benchmark_host_ns();
+}
+
+static void bus_transfer(uint32_t byte_count) {
+    bus.bus_free = bus.now + byte_count * NS_PER_BYTE;
+}
+
+static bool benchmark_comms_init(painter_device_t device) {
+    return dummy_comms_vtable.comms_init(device);
+}
+
+static bool benchmark_comms_start(painter_device_t device) {
+    return dummy_comms_vtable.comms_start(device);
+}
+
+static void benchmark_comms_stop(painter_device_t device) {
+    bus_enter();
+    bus_leave();
+    dummy_comms_vtable.comms_stop(device);
+}
+
+static uint32_t benchmark_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    bus_enter();
+    bus.stats.sent_hash = fnv1a(bus.stats.sent_hash, data, byte_count);
+    bus.stats.wire_hash = fnv1a(bus.stats.wire_hash, data, byte_count);
+    bus.stats.bytes += byte_count;
+    bus.stats.wire_ns += byte_count * NS_PER_BYTE;
+    bus_transfer(byte_count);
+    bus.now = bus.bus_free;
+    bus_leave();
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+static uint32_t benchmark_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    bus_enter();
+    bus.stats.sent_hash = fnv1a(bus.stats.sent_hash, data, byte_count);
+    bus.stats.bytes += byte_count;
+    bus.stats.wire_ns += byte_count * NS_PER_BYTE;
+    bus.pending        = (const uint8_t *)data;
+    bus.pending_length = byte_count;
+    bus_transfer(byte_count);
+    bus_leave();
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+static void benchmark_comms_send_command(painter_device_t device, uint8_t cmd) {
+    bus_enter();
+    bus_transfer(1);
+    bus.now = bus.bus_free;
+    bus_leave();
+}
+
+static void benchmark_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    // Delays are skipped, as the panel is only initialised once
+    for (size_t i = 0; i < sequence_len;) {
+        uint8_t num_bytes = sequence[i + 2];
+        benchmark_comms_send_command(device, sequence[i]);
+        if (num_bytes > 0) {
+            benchmark_comms_send(device, &sequence[i + 3], num_bytes);
+        }
+        i += (3 + num_bytes);
+    }
+}
+
+static const painter_comms_with_command_vtable_t benchmark_comms_vtable = {
+    .base =
+        {
+            .comms_init       = benchmark_comms_init,
+            .comms_start      = benchmark_comms_start,
+            .comms_send       = benchmark_comms_send,
+            .comms_send_async = benchmark_comms_send_async,
+            .comms_stop       = benchmark_comms_stop,
+        },
+    .send_command          = benchmark_comms_send_command,
+    .bulk_command_sequence = benchmark_comms_bulk_command_sequence,
+};
+
+void painter_benchmark_start(void) {
+    const char *cpu_scale = getenv("QMK_PAINTER_CPU_SCALE");
+
+    memset(&bus, 0, sizeof(bus));
+    bus.cpu_scale       = cpu_scale ? atoi(cpu_scale) : PAINTER_BENCHMARK_CPU_SCALE;
+    bus.stats.sent_hash = 2166136261UL;
+    bus.stats.wire_hash = 2166136261UL;
+    bus.host_last       = painter_benchmark_host_ns();
+}
+
+painter_benchmark_stats_t painter_benchmark_stop(void) {
+    bus_enter();
+    bus.stats.total_ns = bus.now;
+    bus_leave();
+    return bus.stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Devices
+
+static tft_panel_dc_reset_painter_device_t panel;
+
+painter_device_t painter_benchmark_panel(void) {
+    if (!panel.base.driver_vtable) {
+        panel.base.driver_vtable         = (const painter_driver_vtable_t *)&st7789_driver_vtable;
+        panel.base.comms_vtable          = (const painter_comms_vtable_t *)&benchmark_comms_vtable;
+        panel.base.panel_width           = PAINTER_BENCHMARK_WIDTH;
+        panel.base.panel_height          = PAINTER_BENCHMARK_HEIGHT;
+        panel.base.rotation              = QP_ROTATION_0;
+        panel.base.native_bits_per_pixel = 16; // RGB565
+    }
+    return (painter_device_t)&panel;
+}
+
+static uint8_t          surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_HEIGHT, 16)];
+static painter_device_t surface;
+
+painter_device_t painter_benchmark_surface(void) {
+    if (!surface) {
+        surface = qp_make_rgb565_surface(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_HEIGHT, surface_buffer);
+    }
+    return surface;
+}
+
+static uint8_t          mono_surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_HEIGHT, 1)];
+static painter_device_t mono_surface;
+
+painter_device_t painter_benchmark_mono_surface(void) {
+    if (!mono_surface) {
+        mono_surface = qp_make_mono1bpp_surface(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_HEIGHT, mono_surface_buffer);
+    }
+    return mono_surface;
+}
+
+static uint8_t          mirror_surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_HEIGHT, 16)];
+static painter_device_t mirror_surface;
+
+painter_device_t painter_benchmark_mirror_surface(void) {
+    if (!mirror_surface) {
+        mirror_surface = qp_make_rgb565_surface(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_HEIGHT, mirror_surface_buffer);
+    }
+    return mirror_surface;
+}
+
+static uint8_t          tiled_band_buffer[TILED_REQUIRED_BAND_BUFFER_BYTE_SIZE(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_BAND_HEIGHT)];
+static uint8_t          tiled_display_list[PAINTER_BENCHMARK_DISPLAY_LIST_SIZE];
+static painter_device_t tiled;
+
+painter_device_t painter_benchmark_tiled(void) {
+    if (!tiled) {
+        tiled = qp_make_rgb565_tiled(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_HEIGHT, PAINTER_BENCHMARK_BAND_HEIGHT, tiled_band_buffer, tiled_display_list, sizeof(tiled_display_list));
+    }
+    return tiled;
+}
+
+uint32_t painter_benchmark_surface_hash(void) {
+    return fnv1a(2166136261UL, surface_buffer, sizeof(surface_buffer));
+}
+
+uint32_t painter_benchmark_mirror_surface_hash(void) {
+    return fnv1a(2166136261UL, mirror_surface_buffer, sizeof(mirror_surface_buffer));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Images and fonts
+
+static qgf_block_header_v1_t block_header(uint8_t type_id, uint32_t length) {
+    return (qgf_block_header_v1_t){.type_id = type_id, .neg_type_id = (~type_id) & 0xFF, .length = length};
+}
+
+uint32_t painter_benchmark_make_image(uint8_t *buffer, qp_image_format_t format) {
+    const uint8_t  bpp         = format == RGB565_16BPP ? 16 : format == PALETTE_4BPP ? 4 : 1;
+    const uint32_t data_length = (uint32_t)PAINTER_BENCHMARK_WIDTH * PAINTER_BENCHMARK_HEIGHT * bpp / 8;
+    uint8_t *      p           = buffer;
+
+    qgf_graphics_descriptor_v1_t graphics = {
+        .header       = block_header(QGF_GRAPHICS_DESCRIPTOR_TYPEID, sizeof(qgf_graphics_descriptor_v1_t) - sizeof(qgf_block_header_v1_t)),
+        .magic        = QGF_MAGIC,
+        .qgf_version  = 0x01,
+        .image_width  = PAINTER_BENCHMARK_WIDTH,
+        .image_height = PAINTER_BENCHMARK_HEIGHT,
+        .frame_count  = 1,
+    };
+    p += sizeof(graphics);
+
+    // A single frame, immediately after the offsets
+    qgf_block_header_v1_t offsets      = block_header(QGF_FRAME_OFFSET_DESCRIPTOR_TYPEID, sizeof(uint32_t));
+    uint32_t              frame_offset = (p - buffer) + sizeof(offsets) + sizeof(uint32_t);
+    memcpy(p, &offsets, sizeof(offsets));
+    p += sizeof(offsets);
+    memcpy(p, &frame_offset, sizeof(frame_offset));
+    p += sizeof(frame_offset);
+
+    qgf_frame_v1_t frame = {
+        .header             = block_header(QGF_FRAME_DESCRIPTOR_TYPEID, sizeof(qgf_frame_v1_t) - sizeof(qgf_block_header_v1_t)),
+        .format             = format,
+        .compression_scheme = IMAGE_UNCOMPRESSED,
+    };
+    memcpy(p, &frame, sizeof(frame));
+    p += sizeof(frame);
+
+    if (format == PALETTE_4BPP) {
+        qgf_block_header_v1_t palette = block_header(QGF_FRAME_PALETTE_DESCRIPTOR_TYPEID, 16 * sizeof(qgf_palette_entry_v1_t));
+        memcpy(p, &palette, sizeof(palette));
+        p += sizeof(palette);
+        for (uint8_t i = 0; i < 16; i++) {
+            qgf_palette_entry_v1_t entry = {.h = i * 16, .s = 255, .v = 255 - i * 8};
+            memcpy(p, &entry, sizeof(entry));
+            p += sizeof(entry);
+        }
+    }
+
+    qgf_block_header_v1_t data = block_header(QGF_FRAME_DATA_DESCRIPTOR_TYPEID, data_length);
+    memcpy(p, &data, sizeof(data));
+    p += sizeof(data);
+    for (uint32_t i = 0; i < data_length; i++) {
+        *p++ = (i * 7) ^ (i >> 9);
+    }
+
+    graphics.total_file_size     = p - buffer;
+    graphics.neg_total_file_size = ~graphics.total_file_size;
+    memcpy(buffer, &graphics, sizeof(graphics));
+    return graphics.total_file_size;
+}
+
+#define FONT_GLYPH_WIDTH 10
+#define FONT_LINE_HEIGHT 16
+#define FONT_GLYPH_BYTES (FONT_GLYPH_WIDTH * FONT_LINE_HEIGHT * 4 / 8)
+#define FONT_DATA_DESCRIPTOR_TYPEID 0x04
+
+uint32_t painter_benchmark_make_font(uint8_t *buffer, uint16_t num_unicode_glyphs) {
+    const uint32_t num_glyphs = 95 + num_unicode_glyphs;
+    uint8_t *      p          = buffer;
+
+    qff_font_descriptor_v1_t font = {
+        .header             = block_header(QFF_FONT_DESCRIPTOR_TYPEID, sizeof(qff_font_descriptor_v1_t) - sizeof(qgf_block_header_v1_t)),
+        .magic              = QFF_MAGIC,
+        .qff_version        = 0x01,
+        .line_height        = FONT_LINE_HEIGHT,
+        .has_ascii_table    = true,
+        .num_unicode_glyphs = num_unicode_glyphs,
+        .format             = GRAYSCALE_4BPP,
+        .compression_scheme = IMAGE_UNCOMPRESSED,
+    };
+    p += sizeof(font);
+
+    // Glyph data is stored in the same order as the tables, ascii first
+    qgf_block_header_v1_t ascii = block_header(QFF_ASCII_GLYPH_DESCRIPTOR_TYPEID, 95 * sizeof(qff_ascii_glyph_v1_t));
+    memcpy(p, &ascii, sizeof(ascii));
+    p += sizeof(ascii);
+    for (uint32_t i = 0; i < 95; i++) {
+        qff_ascii_glyph_v1_t glyph = {.value = ((i * FONT_GLYPH_BYTES) << QFF_GLYPH_WIDTH_BITS) | FONT_GLYPH_WIDTH};
+        memcpy(p, &glyph, sizeof(glyph));
+        p += sizeof(glyph);
+    }
+
+    qgf_block_header_v1_t unicode = block_header(QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID, num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t));
+    memcpy(p, &unicode, sizeof(unicode));
+    p += sizeof(unicode);
+    for (uint32_t i = 0; i < num_unicode_glyphs; i++) {
+        qff_unicode_glyph_v1_t glyph = {.code_point = 0x400 + i * 3, .value = (((95 + i) * FONT_GLYPH_BYTES) << QFF_GLYPH_WIDTH_BITS) | FONT_GLYPH_WIDTH};
+        memcpy(p, &glyph, sizeof(glyph));
+        p += sizeof(glyph);
+    }
+
+    qgf_block_header_v1_t data = block_header(FONT_DATA_DESCRIPTOR_TYPEID, num_glyphs * FONT_GLYPH_BYTES);
+    memcpy(p, &data, sizeof(data));
+    p += sizeof(data);
+    for (uint32_t i = 0; i < num_glyphs * FONT_GLYPH_BYTES; i++) {
+        *p++ = (i * 13) ^ (i >> 7);
+    }
+
+    font.total_file_size     = p - buffer;
+    font.neg_total_file_size = ~font.total_file_size;
+    memcpy(buffer, &font, sizeof(font));
+    return font.total_file_size;
+}
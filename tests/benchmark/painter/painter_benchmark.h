@@ -0,0 +1,61 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_tiled.h"
+
+#define PAINTER_BENCHMARK_WIDTH 240
+#define PAINTER_BENCHMARK_HEIGHT 320
+#define PAINTER_BENCHMARK_BAND_HEIGHT 32
+#define PAINTER_BENCHMARK_DISPLAY_LIST_SIZE 1024
+
+typedef struct painter_benchmark_stats_t {
+    uint64_t bytes;     // pixel data sent to the panel
+    uint64_t cpu_ns;    // time spent drawing, scaled to the simulated MCU
+    uint64_t wire_ns;   // time the simulated bus spent sending pixel data
+    uint64_t total_ns;  // simulated time from the start of the draw until the bus is idle again
+    uint32_t sent_hash; // hash of the pixel data at the time it was handed to the comms driver
+    uint32_t wire_hash; // hash of the pixel data at the time the bus finished sending it
+} painter_benchmark_stats_t;
+
+/* Returns a 240x320 ST7789 panel, on a simulated SPI bus */
+painter_device_t painter_benchmark_panel(void);
+
+/* Returns a 240x320 RGB565 surface */
+painter_device_t painter_benchmark_surface(void);
+
+/* Returns a 240x320 1bpp monochrome surface */
+painter_device_t painter_benchmark_mono_surface(void);
+
+/* Returns a second 240x320 RGB565 surface, to check what another surface transfers to it */
+painter_device_t painter_benchmark_mirror_surface(void);
+
+/* Returns a tiled renderer for a 240x320 RGB565 panel, rendering 32 rows at a time from a 1kB display list */
+painter_device_t painter_benchmark_tiled(void);
+
+/* Clears the statistics, and starts the simulated clock */
+void painter_benchmark_start(void);
+
+/* Waits for the simulated bus to finish, and returns the statistics since painter_benchmark_start() */
+painter_benchmark_stats_t painter_benchmark_stop(void);
+
+/* Writes a full screen, uncompressed QGF image in PALETTE_4BPP, GRAYSCALE_1BPP or RGB565_16BPP format, returns its size */
+uint32_t painter_benchmark_make_image(uint8_t *buffer, qp_image_format_t format);
+
+/* Writes a 4bpp grayscale QFF font with 10x16 glyphs, an ASCII table and unicode glyphs at 0x400, 0x403, 0x406..., returns its size */
+uint32_t painter_benchmark_make_font(uint8_t *buffer, uint16_t num_unicode_glyphs);
+
+/* Returns a hash of the RGB565 surface's framebuffer */
+uint32_t painter_benchmark_surface_hash(void);
+
+/* Returns a hash of the mirror surface's framebuffer */
+uint32_t painter_benchmark_mirror_surface_hash(void);
+
+/* Returns the host time in nanoseconds */
+uint64_t painter_benchmark_host_ns(void);
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS 1
+#define SURFACE_NUM_DEVICES 3
+#define QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT 1
@@ -0,0 +1,9 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Same benchmark as the parent directory, with a single pixdata buffer.
+
+include tests/benchmark/painter/test.mk
+
+VPATH += tests/benchmark/painter
+SRC += tests/benchmark/painter/test_painter_benchmark.cpp
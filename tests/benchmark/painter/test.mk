@@ -0,0 +1,15 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface tiled
+
+# The ST7789 driver is built without SPI, the panel is connected to the simulated bus in painter_benchmark.c instead.
+OPT_DEFS += -DQUANTUM_PAINTER_ST7789_ENABLE
+VPATH += \
+    drivers/painter/tft_panel \
+    drivers/painter/st77xx
+SRC += \
+    drivers/painter/tft_panel/qp_tft_panel.c \
+    drivers/painter/st77xx/qp_st7789.c \
+    tests/benchmark/painter/painter_benchmark.c
@@ -0,0 +1,414 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+extern "C" {
+#include "painter_benchmark.h"
+#include "qff.h"
+}
+
+#define FULL_SCREEN_BYTES ((uint32_t)PAINTER_BENCHMARK_WIDTH * PAINTER_BENCHMARK_HEIGHT * 2)
+
+static uint8_t image_buffer[FULL_SCREEN_BYTES + 1024];
+static uint8_t font_buffer[32768];
+
+// A status screen, mostly ascii with some unicode glyphs (U+0400, U+0403, ... in the benchmark font)
+static const char* status_lines[] = {
+    "Layer: Base    WPM: 87    Caps: off",
+    "CPU 42%  RAM 13%  \u0400\u0403\u0406\u0409\u040c",
+    "\u0412\u0415\u0418 Mode: \u04b1\u04b4 Typing Heatmap",
+    "Battery 96%  \u0430\u0433\u0436\u0439 12:34:56",
+};
+
+// An area of a dashboard which gets updated, as drawn by qp_rect()
+struct dashboard_area_t {
+    uint16_t l, t, r, b;
+};
+
+class PainterBenchmark : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        panel = painter_benchmark_panel();
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+    }
+
+    /* Prints the simulated draw time, and how close it gets to the bus line rate */
+    void report(const char* name, const painter_benchmark_stats_t& stats) {
+        std::cout << "[ PAINTER  ] " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2) << std::setw(8) << stats.total_ns / 1e6 << " ms" << std::setw(8) << stats.cpu_ns / 1e6 << " ms drawing" << std::setw(8) << stats.wire_ns / 1e6 << " ms on the bus" << std::setprecision(1) << std::setw(7) << 100.0 * stats.wire_ns / stats.total_ns << "% of line rate, " << QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT << " pixdata buffer(s)" << std::endl;
+    }
+
+    /* Prints the fastest host time of a draw */
+    void report_host(const char* name, uint64_t ns) {
+        std::cout << "[ PAINTER  ] " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(3) << std::setw(8) << ns / 1e6 << " ms on the host" << std::endl;
+    }
+
+    /* Draws an image to a surface a few times, and reports the fastest host time */
+    void draw_image_host(const char* name, painter_device_t surface, qp_image_format_t format) {
+        ASSERT_NE(surface, nullptr);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        painter_benchmark_make_image(image_buffer, format);
+        painter_image_handle_t image = qp_load_image_mem(image_buffer);
+        ASSERT_NE(image, nullptr);
+
+        uint64_t fastest = UINT64_MAX;
+        for (int i = 0; i < 10; i++) {
+            qp_clear(surface);
+            uint64_t start = painter_benchmark_host_ns();
+            EXPECT_TRUE(qp_drawimage(surface, 0, 0, image));
+            uint64_t elapsed = painter_benchmark_host_ns() - start;
+            if (elapsed < fastest) {
+                fastest = elapsed;
+            }
+        }
+        qp_close_image(image);
+
+        report_host(name, fastest);
+    }
+
+    void draw_image(const char* name, qp_image_format_t format) {
+        painter_benchmark_make_image(image_buffer, format);
+        painter_image_handle_t image = qp_load_image_mem(image_buffer);
+        ASSERT_NE(image, nullptr);
+
+        painter_benchmark_start();
+        EXPECT_TRUE(qp_drawimage(panel, 0, 0, image));
+        painter_benchmark_stats_t stats = painter_benchmark_stop();
+        qp_close_image(image);
+
+        report(name, stats);
+        EXPECT_GE(stats.bytes, FULL_SCREEN_BYTES);
+        // no pixel data may change while it is being sent
+        EXPECT_EQ(stats.sent_hash, stats.wire_hash);
+    }
+
+    /* Prints how much a partial surface transfer sent, compared to sending the bounding box of the changes */
+    void report_bytes(const char* name, uint64_t bytes, uint32_t bounding_box_bytes) {
+        std::cout << "[ PAINTER  ] " << std::left << std::setw(16) << name << std::right << std::setw(8) << bytes << " bytes" << std::setw(8) << bounding_box_bytes << " bytes for the bounding box, " << SURFACE_DIRTY_RECTS << " dirty rect(s)" << std::endl;
+    }
+
+    void draw_areas(painter_device_t surface, const dashboard_area_t* areas, size_t count, uint8_t hue) {
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_TRUE(qp_rect(surface, areas[i].l, areas[i].t, areas[i].r, areas[i].b, hue, 255, 255, true));
+        }
+    }
+
+    /* Updates some areas of a surface, and measures how much of it is sent to the panel */
+    void transfer_areas(const char* name, const dashboard_area_t* areas, size_t count, bool disjoint) {
+        painter_device_t surface = painter_benchmark_surface();
+        painter_device_t mirror  = painter_benchmark_mirror_surface();
+        ASSERT_NE(surface, nullptr);
+        ASSERT_NE(mirror, nullptr);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mirror, QP_ROTATION_0));
+        EXPECT_TRUE(qp_surface_draw(surface, mirror, 0, 0, true));
+
+        // Sending only the dirty areas has to be enough to bring another copy of the surface up to date
+        draw_areas(surface, areas, count, 85);
+        EXPECT_TRUE(qp_surface_draw(surface, mirror, 0, 0, false));
+        EXPECT_EQ(painter_benchmark_mirror_surface_hash(), painter_benchmark_surface_hash());
+
+        draw_areas(surface, areas, count, 170);
+        painter_benchmark_start();
+        EXPECT_TRUE(qp_surface_draw(surface, panel, 0, 0, false));
+        painter_benchmark_stats_t stats = painter_benchmark_stop();
+
+        dashboard_area_t bounding_box = areas[0];
+        uint32_t         area_bytes   = 0;
+        for (size_t i = 0; i < count; i++) {
+            bounding_box.l = std::min(bounding_box.l, areas[i].l);
+            bounding_box.t = std::min(bounding_box.t, areas[i].t);
+            bounding_box.r = std::max(bounding_box.r, areas[i].r);
+            bounding_box.b = std::max(bounding_box.b, areas[i].b);
+            area_bytes += (areas[i].r - areas[i].l + 1) * (areas[i].b - areas[i].t + 1) * 2;
+        }
+        uint32_t bounding_box_bytes = (bounding_box.r - bounding_box.l + 1) * (bounding_box.b - bounding_box.t + 1) * 2;
+
+        report_bytes(name, stats.bytes, bounding_box_bytes);
+        if (disjoint) {
+            EXPECT_GE(stats.bytes, area_bytes);
+#if SURFACE_DIRTY_RECTS > 1
+            EXPECT_LT(stats.bytes, bounding_box_bytes);
+#endif
+        }
+        EXPECT_EQ(stats.sent_hash, stats.wire_hash);
+    }
+
+    /* Draws a status screen over a full screen image, using every kind of primitive */
+    void draw_scene(painter_device_t device, painter_image_handle_t image, painter_font_handle_t font) {
+        EXPECT_TRUE(qp_drawimage(device, 0, 0, image));
+        EXPECT_TRUE(qp_rect(device, 10, 10, 229, 59, 0, 255, 255, true));
+        EXPECT_TRUE(qp_rect(device, 20, 100, 219, 139, 85, 255, 255, false));
+        EXPECT_TRUE(qp_circle(device, 120, 200, 40, 170, 255, 255, true));
+        EXPECT_TRUE(qp_ellipse(device, 60, 260, 50, 20, 42, 255, 255, false));
+        EXPECT_TRUE(qp_line(device, 0, 319, 239, 150, 200, 255, 255));
+        EXPECT_TRUE(qp_setpixel(device, 5, 300, 0, 0, 255));
+        EXPECT_GT(qp_drawtext(device, 12, 24, font, status_lines[0]), 0);
+        // crosses the boundary between two bands
+        EXPECT_GT(qp_drawtext_recolor(device, 0, 150, font, status_lines[2], 0, 0, 0, 42, 255, 255), 0);
+    }
+
+    /* Redraws the top widget of the scene */
+    void draw_widget(painter_device_t device, painter_font_handle_t font) {
+        EXPECT_TRUE(qp_rect(device, 10, 10, 229, 59, 85, 255, 255, true));
+        EXPECT_GT(qp_drawtext(device, 12, 24, font, "WPM: 120"), 0);
+    }
+
+    painter_device_t panel;
+};
+
+TEST_F(PainterBenchmark, PaletteImage) {
+    draw_image("palette image", PALETTE_4BPP);
+}
+
+TEST_F(PainterBenchmark, NativeImage) {
+    draw_image("native image", RGB565_16BPP);
+}
+
+TEST_F(PainterBenchmark, FilledRect) {
+    painter_benchmark_start();
+    EXPECT_TRUE(qp_rect(panel, 0, 0, PAINTER_BENCHMARK_WIDTH - 1, PAINTER_BENCHMARK_HEIGHT - 1, 0, 255, 255, true));
+    painter_benchmark_stats_t stats = painter_benchmark_stop();
+
+    report("filled rect", stats);
+    EXPECT_GE(stats.bytes, FULL_SCREEN_BYTES);
+    EXPECT_EQ(stats.sent_hash, stats.wire_hash);
+}
+
+TEST_F(PainterBenchmark, SurfaceDraw) {
+    painter_device_t surface = painter_benchmark_surface();
+    ASSERT_NE(surface, nullptr);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    painter_benchmark_make_image(image_buffer, PALETTE_4BPP);
+    painter_image_handle_t image = qp_load_image_mem(image_buffer);
+    ASSERT_NE(image, nullptr);
+    EXPECT_TRUE(qp_drawimage(surface, 0, 0, image));
+    qp_close_image(image);
+
+    painter_benchmark_start();
+    EXPECT_TRUE(qp_surface_draw(surface, panel, 0, 0, true));
+    painter_benchmark_stats_t stats = painter_benchmark_stop();
+
+    report("surface draw", stats);
+    EXPECT_GE(stats.bytes, FULL_SCREEN_BYTES);
+    EXPECT_EQ(stats.sent_hash, stats.wire_hash);
+}
+
+TEST_F(PainterBenchmark, DirtyCorners) {
+    // Two widgets in opposite corners, e.g. the active layer and the WPM counter
+    static const dashboard_area_t areas[] = {{0, 0, 47, 15}, {192, 304, 239, 319}};
+    transfer_areas("dirty corners", areas, sizeof(areas) / sizeof(areas[0]), true);
+}
+
+TEST_F(PainterBenchmark, DirtyDashboard) {
+    // A clock, an icon with a value next to it, and a status bar
+    static const dashboard_area_t areas[] = {{80, 0, 159, 15}, {8, 148, 23, 163}, {90, 144, 149, 167}, {0, 304, 239, 319}};
+    transfer_areas("dirty dashboard", areas, sizeof(areas) / sizeof(areas[0]), true);
+}
+
+TEST_F(PainterBenchmark, DirtyScattered) {
+    // More separate areas than there are dirty rects, so some of them have to be merged
+    static const dashboard_area_t areas[] = {{0, 0, 7, 7}, {40, 10, 47, 17}, {200, 0, 207, 7}, {120, 100, 127, 107}, {10, 200, 17, 207}, {220, 220, 227, 227}, {100, 300, 107, 307}, {232, 312, 239, 319}};
+    transfer_areas("dirty scattered", areas, sizeof(areas) / sizeof(areas[0]), true);
+}
+
+TEST_F(PainterBenchmark, DirtyOverlapping) {
+    // A value drawn over its own background box, which has to end up as one area
+    static const dashboard_area_t areas[] = {{20, 40, 119, 79}, {60, 60, 159, 99}, {40, 50, 99, 69}};
+    transfer_areas("dirty overlap", areas, sizeof(areas) / sizeof(areas[0]), false);
+}
+
+TEST_F(PainterBenchmark, TiledScene) {
+    painter_device_t tiled   = painter_benchmark_tiled();
+    painter_device_t surface = painter_benchmark_surface();
+    painter_device_t mirror  = painter_benchmark_mirror_surface();
+    ASSERT_NE(tiled, nullptr);
+    ASSERT_TRUE(qp_init(tiled, QP_ROTATION_0));
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    ASSERT_TRUE(qp_init(mirror, QP_ROTATION_0));
+
+    painter_benchmark_make_image(image_buffer, PALETTE_4BPP);
+    painter_image_handle_t image = qp_load_image_mem(image_buffer);
+    ASSERT_NE(image, nullptr);
+    painter_benchmark_make_font(font_buffer, 64);
+    painter_font_handle_t font = qp_load_font_mem(font_buffer);
+    ASSERT_NE(font, nullptr);
+
+    // Rendering band by band has to end up the same as drawing to a full framebuffer
+    draw_scene(surface, image, font);
+    draw_scene(tiled, image, font);
+    EXPECT_TRUE(qp_tiled_draw(tiled, mirror, 0, 0));
+    EXPECT_EQ(painter_benchmark_mirror_surface_hash(), painter_benchmark_surface_hash());
+
+    draw_scene(tiled, image, font);
+    painter_benchmark_start();
+    EXPECT_TRUE(qp_tiled_draw(tiled, panel, 0, 0));
+    painter_benchmark_stats_t stats = painter_benchmark_stop();
+    qp_close_font(font);
+    qp_close_image(image);
+
+    report("tiled scene", stats);
+    std::cout << "[ PAINTER  ] " << std::left << std::setw(16) << "tiled RAM" << std::right << std::setw(8) << TILED_REQUIRED_BAND_BUFFER_BYTE_SIZE(PAINTER_BENCHMARK_WIDTH, PAINTER_BENCHMARK_BAND_HEIGHT) + PAINTER_BENCHMARK_DISPLAY_LIST_SIZE << " bytes" << std::setw(8) << FULL_SCREEN_BYTES << " bytes for a framebuffer" << std::endl;
+    EXPECT_GE(stats.bytes, FULL_SCREEN_BYTES);
+    EXPECT_EQ(stats.sent_hash, stats.wire_hash);
+}
+
+TEST_F(PainterBenchmark, TiledPartialUpdate) {
+    painter_device_t tiled   = painter_benchmark_tiled();
+    painter_device_t surface = painter_benchmark_surface();
+    painter_device_t mirror  = painter_benchmark_mirror_surface();
+    ASSERT_NE(tiled, nullptr);
+    ASSERT_TRUE(qp_init(tiled, QP_ROTATION_0));
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    ASSERT_TRUE(qp_init(mirror, QP_ROTATION_0));
+
+    painter_benchmark_make_image(image_buffer, PALETTE_4BPP);
+    painter_image_handle_t image = qp_load_image_mem(image_buffer);
+    ASSERT_NE(image, nullptr);
+    painter_benchmark_make_font(font_buffer, 64);
+    painter_font_handle_t font = qp_load_font_mem(font_buffer);
+    ASSERT_NE(font, nullptr);
+
+    draw_scene(surface, image, font);
+    draw_scene(tiled, image, font);
+    EXPECT_TRUE(qp_tiled_draw(tiled, mirror, 0, 0));
+
+    // Everything else on the display has to be left alone
+    draw_widget(surface, font);
+    draw_widget(tiled, font);
+    EXPECT_TRUE(qp_tiled_draw(tiled, mirror, 0, 0));
+    EXPECT_EQ(painter_benchmark_mirror_surface_hash(), painter_benchmark_surface_hash());
+
+    draw_widget(tiled, font);
+    painter_benchmark_start();
+    EXPECT_TRUE(qp_tiled_draw(tiled, panel, 0, 0));
+    painter_benchmark_stats_t stats = painter_benchmark_stop();
+    qp_close_font(font);
+    qp_close_image(image);
+
+    report("tiled widget", stats);
+    uint32_t widget_bytes = 220 * 50 * 2;
+    EXPECT_GE(stats.bytes, widget_bytes);
+    EXPECT_LT(stats.bytes, widget_bytes + 64);
+}
+
+TEST_F(PainterBenchmark, TiledDisplayListFull) {
+    painter_device_t tiled = painter_benchmark_tiled();
+    ASSERT_NE(tiled, nullptr);
+    ASSERT_TRUE(qp_init(tiled, QP_ROTATION_0));
+
+    int recorded = 0;
+    while (recorded < PAINTER_BENCHMARK_DISPLAY_LIST_SIZE && qp_rect(tiled, 0, 0, 9, 9, 0, 255, 255, true)) {
+        recorded++;
+    }
+    EXPECT_GT(recorded, 0);
+    EXPECT_LT(recorded, PAINTER_BENCHMARK_DISPLAY_LIST_SIZE);
+
+    // Off-panel draws don't need any room
+    EXPECT_TRUE(qp_rect(tiled, 300, 400, 309, 409, 0, 255, 255, true));
+
+    // Emptying the list makes room again
+    EXPECT_TRUE(qp_flush(tiled));
+    EXPECT_TRUE(qp_rect(tiled, 0, 0, 9, 9, 0, 255, 255, true));
+}
+
+TEST_F(PainterBenchmark, SurfacePaletteImage) {
+    draw_image_host("surface palette", painter_benchmark_surface(), PALETTE_4BPP);
+}
+
+TEST_F(PainterBenchmark, MonoSurfaceImage) {
+    draw_image_host("mono surface", painter_benchmark_mono_surface(), GRAYSCALE_1BPP);
+}
+
+TEST_F(PainterBenchmark, StatusText) {
+    painter_device_t surface = painter_benchmark_surface();
+    ASSERT_NE(surface, nullptr);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    painter_benchmark_make_font(image_buffer, 200);
+    painter_font_handle_t font = qp_load_font_mem(image_buffer);
+    ASSERT_NE(font, nullptr);
+
+    // Redraw the whole status screen a few times, as it would be every frame
+    uint32_t first_hash = 0;
+    uint64_t fastest    = UINT64_MAX;
+    for (int i = 0; i < 10; i++) {
+        qp_clear(surface);
+        uint64_t start = painter_benchmark_host_ns();
+        for (size_t line = 0; line < sizeof(status_lines) / sizeof(status_lines[0]); line++) {
+            EXPECT_GT(qp_drawtext(surface, 0, line * 16, font, status_lines[line]), 0);
+        }
+        uint64_t elapsed = painter_benchmark_host_ns() - start;
+        if (elapsed < fastest) {
+            fastest = elapsed;
+        }
+
+        // every redraw has to look the same as the first
+        if (i == 0) {
+            first_hash = painter_benchmark_surface_hash();
+        } else {
+            EXPECT_EQ(painter_benchmark_surface_hash(), first_hash);
+        }
+    }
+    qp_close_font(font);
+
+    report_host("status text", fastest);
+}
+
+TEST_F(PainterBenchmark, UnicodeLookup) {
+    // Only measures finding glyphs, as qp_textwidth() doesn't draw anything
+    painter_benchmark_make_font(image_buffer, 1000);
+    painter_font_handle_t font = qp_load_font_mem(image_buffer);
+    ASSERT_NE(font, nullptr);
+
+    // 64 code points spread over the whole table
+    char  text[64 * 4 + 1];
+    char* p = text;
+    for (int i = 0; i < 64; i++) {
+        uint32_t code_point = 0x400 + ((i * 61) % 1000) * 3;
+        if (code_point < 0x800) {
+            *p++ = 0xC0 | (code_point >> 6);
+        } else if (code_point < 0x10000) {
+            *p++ = 0xE0 | (code_point >> 12);
+            *p++ = 0x80 | ((code_point >> 6) & 0x3F);
+        } else {
+            *p++ = 0xF0 | (code_point >> 18);
+            *p++ = 0x80 | ((code_point >> 12) & 0x3F);
+            *p++ = 0x80 | ((code_point >> 6) & 0x3F);
+        }
+        *p++ = 0x80 | (code_point & 0x3F);
+    }
+    *p = 0;
+
+    uint64_t fastest = UINT64_MAX;
+    for (int i = 0; i < 10; i++) {
+        uint64_t start = painter_benchmark_host_ns();
+        EXPECT_EQ(qp_textwidth(font, text), 64 * 10);
+        uint64_t elapsed = painter_benchmark_host_ns() - start;
+        if (elapsed < fastest) {
+            fastest = elapsed;
+        }
+    }
+    qp_close_font(font);
+
+    report_host("unicode lookup", fastest);
+}
+
+TEST_F(PainterBenchmark, UnsortedFontIsRejected) {
+    painter_benchmark_make_font(image_buffer, 4);
+
+    // Swap the first two unicode glyph entries
+    uint8_t* table = image_buffer + sizeof(qff_font_descriptor_v1_t) + sizeof(qff_ascii_glyph_table_v1_t) + sizeof(qgf_block_header_v1_t);
+    uint8_t  first[sizeof(qff_unicode_glyph_v1_t)];
+    memcpy(first, table, sizeof(first));
+    memcpy(table, table + sizeof(first), sizeof(first));
+    memcpy(table + sizeof(first), first, sizeof(first));
+
+    EXPECT_EQ(qp_load_font_mem(image_buffer), nullptr);
+}
@@ -0,0 +1,95 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "quantum.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class ComboKeycodeIndex : public TestFixture {};
+
+TEST_F(ComboKeycodeIndex, two_key_combos_sharing_a_key) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    KeymapKey  key_c(0, 2, 0, KC_C);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    idle_for(COMBO_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_TAB));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_b, key_c});
+    idle_for(COMBO_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, longer_overlapping_combo_wins) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    KeymapKey  key_c(0, 2, 0, KC_C);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b, key_c});
+    idle_for(COMBO_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, key_outside_any_combo_is_not_buffered) {
+    TestDriver driver;
+    KeymapKey  key_f(0, 5, 0, KC_F);
+    set_keymap({key_f});
+
+    EXPECT_REPORT(driver, (KC_F));
+    key_f.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_f.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, combo_key_tapped_alone) {
+    TestDriver driver;
+    KeymapKey  key_d(0, 3, 0, KC_D);
+    set_keymap({key_d});
+
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_d);
+    idle_for(COMBO_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, index_is_rebuilt_after_reset) {
+    TestDriver driver;
+    KeymapKey  key_d(0, 3, 0, KC_D);
+    KeymapKey  key_e(0, 4, 0, KC_E);
+    set_keymap({key_d, key_e});
+
+    combo_keycode_index_reset();
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_d, key_e});
+    idle_for(COMBO_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,11 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_KEYMAP_RAM_MIRROR
+#define DYNAMIC_KEYMAP_WRITE_DELAY 100
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define EEPROM_SIZE 512
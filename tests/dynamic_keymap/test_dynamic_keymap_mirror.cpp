@@ -0,0 +1,100 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+}
+
+class DynamicKeymapMirror : public TestFixture {
+   protected:
+    void SetUp() override {
+        dynamic_keymap_reset();
+    }
+
+    uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymapMirror, LoadsFromEeprom) {
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(1, 2, 3);
+    eeprom_update_byte(address, 0x12);
+    eeprom_update_byte(address + 1, 0x34);
+    dynamic_keymap_mirror_invalidate();
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), 0x1234);
+}
+
+TEST_F(DynamicKeymapMirror, ReadsDoNotTouchEeprom) {
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 3, 5);
+    eeprom_update_byte(address, 0x56);
+    eeprom_update_byte(address + 1, 0x78);
+
+    /* loaded by keyboard_init(), EEPROM changes only show up once invalidated */
+    EXPECT_NE(dynamic_keymap_get_keycode(0, 3, 5), 0x5678);
+    dynamic_keymap_mirror_invalidate();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 3, 5), 0x5678);
+}
+
+TEST_F(DynamicKeymapMirror, WriteIsDeferred) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(0, 1, 2, KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 2), KC_B);
+
+    idle_for(DYNAMIC_KEYMAP_WRITE_DELAY - 1);
+    EXPECT_NE(eeprom_keycode(0, 1, 2), KC_B);
+
+    idle_for(2);
+    EXPECT_EQ(eeprom_keycode(0, 1, 2), KC_B);
+}
+
+TEST_F(DynamicKeymapMirror, FurtherWritesPostponeFlush) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+    idle_for(DYNAMIC_KEYMAP_WRITE_DELAY / 2);
+    dynamic_keymap_set_keycode(1, 3, 9, KC_Z);
+    idle_for(DYNAMIC_KEYMAP_WRITE_DELAY - 1);
+    EXPECT_NE(eeprom_keycode(0, 0, 0), KC_A);
+    EXPECT_NE(eeprom_keycode(1, 3, 9), KC_Z);
+
+    /* one chunk per task */
+    idle_for(3);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_A);
+    EXPECT_EQ(eeprom_keycode(1, 3, 9), KC_Z);
+}
+
+TEST_F(DynamicKeymapMirror, Flush) {
+    dynamic_keymap_set_keycode(1, 3, 4, KC_C);
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(1, 3, 4), KC_C);
+}
+
+TEST_F(DynamicKeymapMirror, Buffer) {
+    uint8_t data[28];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+    uint16_t offset = MATRIX_COLS * 2 - 4;
+    dynamic_keymap_set_buffer(offset, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, MATRIX_COLS - 2), 0x0001);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 0), 0x0405);
+
+    uint8_t read[sizeof(data)] = {0};
+    dynamic_keymap_get_buffer(offset, sizeof(read), read);
+    EXPECT_EQ(memcmp(read, data, sizeof(data)), 0);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(0, 1, 0), 0x0405);
+}
+
+TEST_F(DynamicKeymapMirror, ResetWritesThrough) {
+    dynamic_keymap_set_keycode(1, 1, 1, KC_D);
+    dynamic_keymap_reset();
+    EXPECT_EQ(eeprom_keycode(1, 1, 1), dynamic_keymap_get_keycode(1, 1, 1));
+    EXPECT_NE(eeprom_keycode(1, 1, 1), KC_D);
+}
@@ -0,0 +1,279 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "latency_profiler.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "action.h"
+#include "action_util.h"
+#include "debounce.h"
+#include "debug.h"
+#include "host.h"
+#include "keyboard.h"
+#include "matrix.h"
+
+void advance_time(uint32_t ms);
+}
+
+LatencyProfiler& LatencyProfiler::instance() {
+    static LatencyProfiler profiler;
+    return profiler;
+}
+
+void LatencyProfiler::reset() {
+    m_frames.clear();
+    for (auto& samples : m_samples) {
+        samples.clear();
+    }
+    m_custom.clear();
+    m_scan_active = false;
+}
+
+void LatencyProfiler::begin(LatencyStage stage) {
+    if (!m_enabled) {
+        return;
+    }
+
+    auto now = clock::now();
+    if (stage == LatencyStage::MatrixScan) {
+        m_scan_start    = now;
+        m_scan_excluded = clock::duration::zero();
+        m_scan_active   = true;
+    }
+    m_frames.push_back({stage, now, clock::duration::zero()});
+}
+
+void LatencyProfiler::end(LatencyStage stage) {
+    if (!m_enabled || m_frames.empty()) {
+        return;
+    }
+
+    auto  now   = clock::now();
+    Frame frame = m_frames.back();
+    m_frames.pop_back();
+    if (frame.stage != stage) {
+        // Unbalanced begin/end, e.g. profiling was enabled mid-stage. Drop the sample.
+        m_frames.clear();
+        return;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - frame.start - frame.excluded);
+    m_samples[static_cast<size_t>(stage)].push_back(elapsed.count());
+}
+
+void LatencyProfiler::begin_host_send() {
+    if (!m_enabled) {
+        return;
+    }
+
+    m_host_start = clock::now();
+    if (m_scan_active) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(m_host_start - m_scan_start - m_scan_excluded);
+        m_samples[static_cast<size_t>(LatencyStage::ScanToReport)].push_back(elapsed.count());
+    }
+}
+
+void LatencyProfiler::end_host_send() {
+    if (!m_enabled) {
+        return;
+    }
+
+    auto host_time = clock::now() - m_host_start;
+    for (auto& frame : m_frames) {
+        frame.excluded += host_time;
+    }
+    m_scan_excluded += host_time;
+}
+
+void LatencyProfiler::add_sample(const std::string& label, uint64_t ns) {
+    if (!m_enabled) {
+        return;
+    }
+
+    for (auto& custom : m_custom) {
+        if (custom.first == label) {
+            custom.second.push_back(ns);
+            return;
+        }
+    }
+    m_custom.emplace_back(label, std::vector<uint64_t>{ns});
+}
+
+const std::vector<uint64_t>& LatencyProfiler::samples(const std::string& label) const {
+    static const std::vector<uint64_t> empty;
+
+    for (auto& custom : m_custom) {
+        if (custom.first == label) {
+            return custom.second;
+        }
+    }
+    return empty;
+}
+
+LatencySummary LatencyProfiler::summarize(std::vector<uint64_t> sorted) {
+    LatencySummary summary{};
+
+    summary.count = sorted.size();
+    if (sorted.empty()) {
+        return summary;
+    }
+
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&](unsigned pct) { return sorted[std::min(sorted.size() - 1, (sorted.size() * pct) / 100)]; };
+
+    uint64_t sum = 0;
+    for (auto sample : sorted) {
+        sum += sample;
+    }
+
+    summary.min_ns  = sorted.front();
+    summary.p50_ns  = percentile(50);
+    summary.p90_ns  = percentile(90);
+    summary.p99_ns  = percentile(99);
+    summary.max_ns  = sorted.back();
+    summary.mean_ns = sum / sorted.size();
+    return summary;
+}
+
+const char* LatencyProfiler::stage_name(LatencyStage stage) {
+    switch (stage) {
+        case LatencyStage::MatrixScan:
+            return "matrix_scan";
+        case LatencyStage::Debounce:
+            return "debounce";
+        case LatencyStage::ActionExec:
+            return "action_exec";
+        case LatencyStage::ProcessRecord:
+            return "process_record";
+        case LatencyStage::ReportBuild:
+            return "send_keyboard_report";
+        case LatencyStage::ScanToReport:
+            return "scan_to_report";
+        default:
+            return "unknown";
+    }
+}
+
+void LatencyProfiler::report_row(std::ostream& csv, const std::string& name, const char* label, const std::vector<uint64_t>& samples) const {
+    LatencySummary summary = summarize(samples);
+    if (summary.count == 0) {
+        return;
+    }
+
+    auto us = [](uint64_t ns) { return ns / 1000.0; };
+
+    std::cout << "[ LATENCY  ] " << std::left << std::setw(24) << label << std::right << std::setw(8) << summary.count << std::fixed << std::setprecision(2) << std::setw(10) << us(summary.min_ns) << std::setw(10) << us(summary.p50_ns) << std::setw(10) << us(summary.p90_ns) << std::setw(10) << us(summary.p99_ns) << std::setw(10) << us(summary.max_ns) << std::endl;
+    csv << name << "," << label << "," << summary.count << "," << summary.min_ns << "," << summary.p50_ns << "," << summary.p90_ns << "," << summary.p99_ns << "," << summary.max_ns << "," << summary.mean_ns << std::endl;
+}
+
+void LatencyProfiler::report(const std::string& name) const {
+    const char*   csv_path = std::getenv("QMK_LATENCY_CSV");
+    std::ofstream csv;
+    if (csv_path) {
+        csv.open(csv_path, std::ios::app);
+    }
+
+    std::cout << "[ LATENCY  ] " << name << " (microseconds)" << std::endl;
+    std::cout << "[ LATENCY  ] " << std::left << std::setw(24) << "stage" << std::right << std::setw(8) << "count" << std::setw(10) << "min" << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10) << "max" << std::endl;
+
+    for (size_t i = 0; i < static_cast<size_t>(LatencyStage::Count); i++) {
+        auto stage = static_cast<LatencyStage>(i);
+        report_row(csv, name, stage_name(stage), samples(stage));
+    }
+    for (auto& custom : m_custom) {
+        report_row(csv, name, custom.first.c_str(), custom.second);
+    }
+}
+
+void LatencyBenchmark::SetUp() {
+    m_debug_config   = debug_config.raw;
+    debug_config.raw = 0;
+    LatencyProfiler::instance().reset();
+    LatencyProfiler::instance().enable(true);
+}
+
+void LatencyBenchmark::TearDown() {
+    LatencyProfiler::instance().enable(false);
+    debug_config.raw = m_debug_config;
+}
+
+void LatencyBenchmark::scan_for(unsigned ms) {
+    for (unsigned i = 0; i < ms; i++) {
+        keyboard_task();
+        advance_time(1);
+    }
+}
+
+void LatencyBenchmark::tap(KeymapKey key, unsigned hold_ms, unsigned idle_ms) {
+    press_key(key.position.col, key.position.row);
+    scan_for(hold_ms);
+    release_key(key.position.col, key.position.row);
+    scan_for(idle_ms);
+}
+
+void LatencyBenchmark::report() const {
+    const ::testing::TestInfo* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    LatencyProfiler::instance().report(std::string(test_info->test_suite_name()) + "." + test_info->name());
+}
+
+/* Linker wrapped entry points, see latency_profiler.mk. Only calls crossing translation
+ * units are redirected, which is the case for every stage boundary timed here. */
+extern "C" {
+uint8_t __real_matrix_scan(void);
+bool    __real_debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+void    __real_action_exec(keyevent_t event);
+void    __real_process_record(keyrecord_t* record);
+void    __real_send_keyboard_report(void);
+void    __real_host_keyboard_send(report_keyboard_t* report);
+
+uint8_t __wrap_matrix_scan(void) {
+    LatencyProfiler::instance().begin(LatencyStage::MatrixScan);
+    uint8_t ret = __real_matrix_scan();
+    LatencyProfiler::instance().end(LatencyStage::MatrixScan);
+    return ret;
+}
+
+bool __wrap_debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    LatencyProfiler::instance().begin(LatencyStage::Debounce);
+    bool ret = __real_debounce(raw, cooked, num_rows, changed);
+    LatencyProfiler::instance().end(LatencyStage::Debounce);
+    return ret;
+}
+
+void __wrap_action_exec(keyevent_t event) {
+    if (!IS_EVENT(event)) {
+        // Tick events run every scan, only time actual key events.
+        __real_action_exec(event);
+        return;
+    }
+
+    LatencyProfiler::instance().begin(LatencyStage::ActionExec);
+    __real_action_exec(event);
+    LatencyProfiler::instance().end(LatencyStage::ActionExec);
+}
+
+void __wrap_process_record(keyrecord_t* record) {
+    LatencyProfiler::instance().begin(LatencyStage::ProcessRecord);
+    __real_process_record(record);
+    LatencyProfiler::instance().end(LatencyStage::ProcessRecord);
+}
+
+void __wrap_send_keyboard_report(void) {
+    LatencyProfiler::instance().begin(LatencyStage::ReportBuild);
+    __real_send_keyboard_report();
+    LatencyProfiler::instance().end(LatencyStage::ReportBuild);
+}
+
+void __wrap_host_keyboard_send(report_keyboard_t* report) {
+    LatencyProfiler::instance().begin_host_send();
+    __real_host_keyboard_send(report);
+    LatencyProfiler::instance().end_host_send();
+}
+}
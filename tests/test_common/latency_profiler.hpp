@@ -0,0 +1,137 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+/**
+ * @brief Pipeline stages timed by the latency profiler.
+ *
+ * Each stage is entered through a linker-wrapped entry point, see latency_profiler.mk.
+ * Durations are inclusive of nested stages but exclude time spent inside the host
+ * driver (i.e. the mocked `host_keyboard_send`), so numbers reflect firmware work only.
+ */
+enum class LatencyStage : uint8_t {
+    MatrixScan,    // matrix_scan(), including debounce
+    Debounce,      // debounce()
+    ActionExec,    // action_exec() for key events, including tapping and combo buffering
+    ProcessRecord, // process_record(), i.e. the process_record_quantum() chain and the action handler
+    ReportBuild,   // send_keyboard_report(), report assembly up to the host driver
+    ScanToReport,  // matrix_scan() entry to host_keyboard_send() within the same keyboard_task()
+    Count,
+};
+
+struct LatencySummary {
+    size_t   count;
+    uint64_t min_ns;
+    uint64_t p50_ns;
+    uint64_t p90_ns;
+    uint64_t p99_ns;
+    uint64_t max_ns;
+    uint64_t mean_ns;
+};
+
+class LatencyProfiler {
+   public:
+    using clock = std::chrono::steady_clock;
+
+    static LatencyProfiler& instance();
+
+    void reset();
+    void enable(bool on) {
+        m_enabled = on;
+    }
+    bool enabled() const {
+        return m_enabled;
+    }
+
+    void begin(LatencyStage stage);
+    void end(LatencyStage stage);
+    void begin_host_send();
+    void end_host_send();
+
+    /**
+     * @brief Records a sample for a benchmark specific stage, e.g. a single feature's
+     * process_* handler. Custom stages are reported after the built-in ones.
+     */
+    void add_sample(const std::string& label, uint64_t ns);
+
+    const std::vector<uint64_t>& samples(LatencyStage stage) const {
+        return m_samples[static_cast<size_t>(stage)];
+    }
+    const std::vector<uint64_t>& samples(const std::string& label) const;
+
+    static LatencySummary summarize(std::vector<uint64_t> samples);
+
+    /**
+     * @brief Prints a percentile table for all stages with samples to stdout.
+     *
+     * When the `QMK_LATENCY_CSV` environment variable names a file, one CSV row per
+     * stage is appended to it as well, so results can be collected and compared
+     * between commits in CI.
+     */
+    void report(const std::string& name) const;
+
+    static const char* stage_name(LatencyStage stage);
+
+   private:
+    struct Frame {
+        LatencyStage      stage;
+        clock::time_point start;
+        clock::duration   excluded;
+    };
+
+    using SampleTable = std::array<std::vector<uint64_t>, static_cast<size_t>(LatencyStage::Count)>;
+    using CustomTable = std::vector<std::pair<std::string, std::vector<uint64_t>>>;
+
+    void report_row(std::ostream& csv, const std::string& name, const char* label, const std::vector<uint64_t>& samples) const;
+
+    bool               m_enabled = false;
+    std::vector<Frame> m_frames;
+    SampleTable        m_samples;
+    CustomTable        m_custom;
+    clock::time_point  m_scan_start;
+    clock::duration    m_scan_excluded;
+    bool               m_scan_active = false;
+    clock::time_point  m_host_start;
+};
+
+/**
+ * @brief Test fixture for latency benchmarks.
+ *
+ * Scripted key streams are driven straight through `keyboard_task()` with the simulated
+ * timer advancing 1ms per scan, while the profiler measures host wall-clock time spent in
+ * each stage. Debug output is silenced for the duration of the benchmark so console
+ * printing does not dominate the numbers.
+ */
+class LatencyBenchmark : public TestFixture {
+   protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    /**
+     * @brief Runs `ms` scan loops without test logging.
+     */
+    void scan_for(unsigned ms);
+
+    /**
+     * @brief Presses `key`, then scans for `hold_ms` before releasing and scanning for `idle_ms`.
+     */
+    void tap(KeymapKey key, unsigned hold_ms, unsigned idle_ms);
+
+    /**
+     * @brief Prints the collected percentiles under the current test name.
+     */
+    void report() const;
+
+   private:
+    uint8_t m_debug_config;
+};
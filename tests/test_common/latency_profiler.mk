@@ -0,0 +1,17 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Include from a test.mk to time the keyboard_task() pipeline with LatencyProfiler.
+# Stage boundaries are intercepted at link time, so firmware sources stay untouched.
+
+SRC += tests/test_common/latency_profiler.cpp
+
+OPT_DEFS += -DTEST_MATRIX_DEBOUNCE
+
+LDFLAGS += \
+	-Wl,--wrap=matrix_scan \
+	-Wl,--wrap=debounce \
+	-Wl,--wrap=action_exec \
+	-Wl,--wrap=process_record \
+	-Wl,--wrap=send_keyboard_report \
+	-Wl,--wrap=host_keyboard_send
@@ -20,18 +20,38 @@
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
+#ifdef TEST_MATRIX_DEBOUNCE
+#    include "debounce.h"
+
+/* Debounced view of `matrix`, which then holds the raw key state set by press_key/release_key. */
+static matrix_row_t cooked_matrix[MATRIX_ROWS]   = {};
+static matrix_row_t previous_matrix[MATRIX_ROWS] = {};
+#endif
+
 void matrix_init(void) {
     clear_all_keys();
+#ifdef TEST_MATRIX_DEBOUNCE
+    debounce_init(MATRIX_ROWS);
+#endif
     matrix_init_kb();
 }
 
 uint8_t matrix_scan(void) {
+#ifdef TEST_MATRIX_DEBOUNCE
+    bool changed = memcmp(previous_matrix, matrix, sizeof(matrix)) != 0;
+    memcpy(previous_matrix, matrix, sizeof(matrix));
+    debounce(matrix, cooked_matrix, MATRIX_ROWS, changed);
+#endif
     matrix_scan_kb();
     return 1;
 }
 
 matrix_row_t matrix_get_row(uint8_t row) {
+#ifdef TEST_MATRIX_DEBOUNCE
+    return cooked_matrix[row];
+#else
     return matrix[row];
+#endif
 }
 
 void matrix_print(void) {}
@@ -99,6 +99,9 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+    layer_lookup_cache_clear();
+#endif
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -126,6 +129,9 @@ void TestFixture::tap_combo(const std::vector<KeymapKey>& chord_keys, unsigned d
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+    layer_lookup_cache_clear();
+#endif
     for (auto& key : keys) {
         add_key(key);
     }